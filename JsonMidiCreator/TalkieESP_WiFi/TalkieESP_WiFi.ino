@@ -20,7 +20,15 @@ https://github.com/ruiseixasm/JsonTalkie
   #define LED_BUILTIN 2  // Fallback definition if not already defined
 #endif
 
+// On the dual core ESP32 the WiFi socket I/O runs in its own task, on core 0 (comment it to run all in loop)
+#if !defined(ESP8266)
+#define WIFI_SOCKET_TASK
+#endif
+
 #include "src/sockets/BroadcastESP_WiFi.hpp"
+#ifdef WIFI_SOCKET_TASK
+#include "src/sockets/ESP_TaskSocket.hpp"
+#endif
 #include "src/manifestos/Spy.hpp"
 #include "src/manifestos/BlueManifesto.hpp"
 #include "src/manifestos/MessageTester.hpp"
@@ -54,7 +62,11 @@ JsonTalker t_tester = JsonTalker(t_tester_name, t_tester_desc, &message_tester);
 // SOCKETS
 
 // Singleton requires the & (to get a reference variable)
+#ifdef WIFI_SOCKET_TASK
+auto& ethernet_socket = ESP_TaskSocket<BroadcastESP_WiFi>::instance();
+#else
 auto& ethernet_socket = BroadcastESP_WiFi::instance();
+#endif
 
 
 // SETTING THE REPEATER
@@ -121,6 +133,13 @@ void setup() {
     Serial.println("Step 4: Setting up broadcast sockets...");
     ethernet_socket.set_port(PORT);
     ethernet_socket.set_udp(&udp);
+	#ifdef WIFI_SOCKET_TASK
+	if (ethernet_socket.startTask()) {
+		Serial.println("\tSocket task started on core 0");
+	} else {
+		Serial.println("\tFailed to start the socket task!");
+	}
+	#endif
 
     // Final startup indication
     digitalWrite(LED_BUILTIN, HIGH);
@@ -137,7 +137,11 @@ struct TalkieCodes {
         TALKIE_SYS_DROPS,     ///< Packet loss statistics
         TALKIE_SYS_DELAY,     ///< Network delay configuration
         TALKIE_SYS_SOCKET,    ///< List Socket class names
-        TALKIE_SYS_MANIFESTO  ///< Show the Manifesto class name
+        TALKIE_SYS_MANIFESTO, ///< Show the Manifesto class name
+        TALKIE_SYS_POLLS,     ///< Polling statistics of the polled devices
+        TALKIE_SYS_DUPLICATES, ///< Duplicated messages dropped by the Repeater
+        TALKIE_SYS_RATE,      ///< Returns or sets the Sockets requests rate limits
+        TALKIE_SYS_TRACE      ///< Dumps the recorded trace events
     };
 
 
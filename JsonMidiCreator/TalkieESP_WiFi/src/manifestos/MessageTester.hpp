@@ -57,6 +57,7 @@ protected:
 		{"copy", "Tests the copy constructor"},
 		{"string", "Checks if it has a value 0 as string"}
     };
+	ActionsHash<sizeof(calls)/sizeof(Action)> _calls_hash{calls};
     
 public:
     
@@ -65,6 +66,10 @@ public:
     // Size methods
     uint8_t _actionsCount() const override { return sizeof(calls)/sizeof(Action); }
 
+	// Many Actions, so, found by name with a single comparison
+	using TalkerManifesto::_actionIndex;
+    uint8_t _actionIndex(const char* name) const override { return _calls_hash.index(name, calls); }
+
 
     // Index-based operations (simplified examples)
     bool _actionByIndex(uint8_t index, JsonTalker& talker, JsonMessage& json_message, TalkerMatch talker_match) override {
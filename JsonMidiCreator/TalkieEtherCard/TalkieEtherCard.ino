@@ -57,12 +57,12 @@ uint8_t mac[] = {0xDE, 0xAD, 0xBE, 0xEF, 0xFE, 0x02};
 
 
 const char nano_name[] = "nano";
-const char nano_desc[] = "Arduino Nano";
+const char nano_desc[] PROGMEM = "Arduino Nano";
 BlackManifesto black_manifesto;
-JsonTalker nano = JsonTalker(nano_name, nano_desc, &black_manifesto);
+JsonTalker nano = JsonTalker(nano_name, FPSTR(nano_desc), &black_manifesto);
 const char uno_name[] = "uno";
-const char uno_desc[] = "Arduino Uno";
-JsonTalker uno = JsonTalker(uno_name, uno_desc);
+const char uno_desc[] PROGMEM = "Arduino Uno";
+JsonTalker uno = JsonTalker(uno_name, FPSTR(uno_desc));
 JsonTalker* downlinked_talkers[] = { &nano, &uno };    // Only an array of pointers preserves polymorphism!!
 // Singleton requires the & (to get a reference variable)
 auto& ethernet_socket = BroadcastSocket_EtherCard::instance();
@@ -32,6 +32,22 @@ https://github.com/ruiseixasm/JsonTalkie
 
 // #define MESSAGE_REPEATER_DEBUG
 
+// Indexes the Talkers by channel and name, taking around 2.3kB of RAM, so, not for the AVR boards
+#if !defined(__AVR__) && !defined(TALKIE_NO_TALKERS_INDEX)
+#define TALKIE_TALKERS_INDEX
+#endif
+
+#define TALKIE_INDEXED_TALKERS 32	///< Maximum Talkers indexed per side, more than these are scanned instead
+
+#ifdef __AVR__
+#define TALKIE_SEEN_MESSAGES 4		///< Messages from Sockets remembered to drop their duplicates
+#else
+#define TALKIE_SEEN_MESSAGES 16		///< Messages from Sockets remembered to drop their duplicates
+#endif
+
+#define TALKIE_BULK_PER_LOOP 1		///< Bulk replies (LIST and TALK) released by each Repeater loop
+#define TALKIE_BULK_MAX_HOLD 8		///< Maximum consecutive loops with Socket traffic that hold the bulk replies
+
 using LinkType			= TalkieCodes::LinkType;
 using TalkerMatch 		= TalkieCodes::TalkerMatch;
 using BroadcastValue 	= TalkieCodes::BroadcastValue;
@@ -43,6 +59,100 @@ using ValueType 		= TalkieCodes::ValueType;
 using Original 			= JsonMessage::Original;
 
 
+#ifdef TALKIE_TALKERS_INDEX
+
+/**
+ * @class TalkersIndex
+ * @brief The Talkers of one side of the Repeater indexed by channel and by name
+ *
+ * Each channel has a bitmap of its Talkers and the names are kept sorted by their hash,
+ * so that the routing cost doesn't grow with the number of Talkers.
+ *
+ * @note The bits and the name entries follow the Talkers order, so, the Talkers are
+ *       processed in the same order as if they were scanned.
+ */
+class TalkersIndex {
+private:
+
+	struct NameEntry {
+		uint16_t name_hash;
+		uint8_t talker_i;
+	};
+
+	uint32_t _channel_talkers[256];
+	NameEntry _names[TALKIE_INDEXED_TALKERS];
+	bool _indexed = false;
+
+public:
+
+	/**
+     * @brief Builds the index from the Talkers
+     * @param talkers The array of Talkers
+     * @param talkers_count The amount of Talkers
+     * @return Returns false if there are too many Talkers to be indexed
+     */
+	bool _build(JsonTalker* const* talkers, uint8_t talkers_count) {
+		_indexed = talkers_count <= TALKIE_INDEXED_TALKERS;
+		if (_indexed) {
+			memset(_channel_talkers, 0, sizeof(_channel_talkers));
+			for (uint8_t talker_i = 0; talker_i < talkers_count; ++talker_i) {
+				_channel_talkers[talkers[talker_i]->get_channel()] |= 1UL << talker_i;
+				// Insertion sort by hash, keeping the Talkers order for equal hashes
+				uint16_t name_hash = JsonMessage::_name_hash(talkers[talker_i]->get_name());
+				uint8_t name_j = talker_i;
+				for (; name_j > 0 && _names[name_j - 1].name_hash > name_hash; --name_j) {
+					_names[name_j] = _names[name_j - 1];
+				}
+				_names[name_j] = { name_hash, talker_i };
+			}
+		}
+		return _indexed;
+	}
+
+
+	bool _isIndexed() const { return _indexed; }
+
+
+	/** @brief Moves a Talker from one channel to another */
+	void _moveChannel(uint8_t talker_i, uint8_t from_channel, uint8_t to_channel) {
+		_channel_talkers[from_channel] &= ~(1UL << talker_i);
+		_channel_talkers[to_channel] |= 1UL << talker_i;
+	}
+
+
+	/** @brief Gets the bitmap of the Talkers with the given channel */
+	uint32_t _channelTalkers(uint8_t channel) const {
+		return _channel_talkers[channel];
+	}
+
+
+	/**
+     * @brief Finds the first name entry with the given hash
+     * @param talkers_count The amount of Talkers
+     * @param name_hash The hash of the name
+     * @return The entry position, equal to `talkers_count` if none
+     */
+	uint8_t _findName(uint8_t talkers_count, uint16_t name_hash) const {
+		uint8_t low = 0, high = talkers_count;
+		while (low < high) {
+			uint8_t middle = (low + high) / 2;
+			if (_names[middle].name_hash < name_hash) {
+				low = middle + 1;
+			} else {
+				high = middle;
+			}
+		}
+		return low < talkers_count && _names[low].name_hash == name_hash ? low : talkers_count;
+	}
+
+
+	uint16_t _nameHash(uint8_t name_j) const { return _names[name_j].name_hash; }
+	uint8_t _nameTalker(uint8_t name_j) const { return _names[name_j].talker_i; }
+};
+
+#endif
+
+
 /**
  * @class MessageRepeater
  * @brief An Interface to be implemented as a Manifesto to define the Talker actions
@@ -62,7 +172,197 @@ private:
 	const uint8_t _downlinked_sockets_count;
 	JsonTalker* const* const _uplinked_talkers;
 	const uint8_t _uplinked_talkers_count;
-	
+
+	#ifdef TALKIE_TALKERS_INDEX
+	TalkersIndex _downlinked_index;
+	TalkersIndex _uplinked_index;
+	#endif
+
+	/**
+	 * @brief A message recently received from a Socket
+	 * @note A `from_hash` of 0 marks a free slot
+	 */
+	struct SeenMessage {
+		uint16_t from_hash;
+		uint16_t identity;
+		uint16_t checksum;
+		MessageValue message_value;
+		uint16_t local_time;
+	};
+
+	SeenMessage _seen_messages[TALKIE_SEEN_MESSAGES];
+	uint8_t _next_seen = 0;
+	uint16_t _duplicates_count = 0;
+
+	#ifdef TALKIE_DEFERRED_BULK
+	bool _socket_traffic = false;
+	uint8_t _bulk_budget = 0;
+	uint8_t _bulk_held = 0;
+	#endif
+
+
+	/**
+     * @brief Transmits a copy of the message to each Talker of a side with the message channel
+     * @param downlinked The side of the Talkers, downlinked or uplinked
+     * @param message A json message to be transmitted
+     * @param talker_match The Talker match of the message
+     * @param except_talker A Talker to skip, the one the message came from
+     */
+	void _transmitByChannel(bool downlinked, JsonMessage &message, TalkerMatch talker_match, const JsonTalker* except_talker = nullptr) {
+		JsonTalker* const* talkers = downlinked ? _downlinked_talkers : _uplinked_talkers;
+		uint8_t message_channel = message.get_to_channel();
+
+		#ifdef TALKIE_TALKERS_INDEX
+		const TalkersIndex& talkers_index = downlinked ? _downlinked_index : _uplinked_index;
+		if (talkers_index._isIndexed()) {
+			uint32_t channel_talkers = talkers_index._channelTalkers(message_channel);
+			while (channel_talkers) {
+				uint8_t talker_i = __builtin_ctz(channel_talkers);
+				channel_talkers &= channel_talkers - 1;
+				if (talkers[talker_i] != except_talker) {
+					JsonMessage message_copy(message);
+					talkers[talker_i]->_handleTransmission(message_copy, talker_match);
+				}
+			}
+			return;
+		}
+		#endif
+
+		uint8_t talkers_count = downlinked ? _downlinked_talkers_count : _uplinked_talkers_count;
+		for (uint8_t talker_i = 0; talker_i < talkers_count; ++talker_i) {
+			if (talkers[talker_i] != except_talker) {
+				uint8_t talker_channel = talkers[talker_i]->get_channel();
+				if (talker_channel == message_channel) {
+					JsonMessage message_copy(message);
+					talkers[talker_i]->_handleTransmission(message_copy, talker_match);
+				}
+			}
+		}
+	}
+
+
+	/**
+     * @brief Transmits the message to the first Talker of a side with the message target name
+     * @param downlinked The side of the Talkers, downlinked or uplinked
+     * @param message A json message to be transmitted
+     * @param talker_match The Talker match of the message
+     * @param except_talker A Talker to skip, the one the message came from
+     * @return Returns true if a Talker was found with that name
+     */
+	bool _transmitByName(bool downlinked, JsonMessage &message, TalkerMatch talker_match, const JsonTalker* except_talker = nullptr) {
+		JsonTalker* const* talkers = downlinked ? _downlinked_talkers : _uplinked_talkers;
+		uint8_t talkers_count = downlinked ? _downlinked_talkers_count : _uplinked_talkers_count;
+
+		#ifdef TALKIE_TALKERS_INDEX
+		const TalkersIndex& talkers_index = downlinked ? _downlinked_index : _uplinked_index;
+		uint16_t name_hash = 0;
+		uint8_t name_j = talkers_count;
+		if (talkers_index._isIndexed()) {
+			name_hash = message.get_to_hash();
+			name_j = talkers_index._findName(talkers_count, name_hash);
+			if (name_j == talkers_count) return false;
+		}
+		#endif
+
+		char message_to_name[TALKIE_NAME_LEN];
+		strcpy(message_to_name, message.get_to_name());
+
+		#ifdef TALKIE_TALKERS_INDEX
+		if (talkers_index._isIndexed()) {
+			// Hashes may collide, so, the names are still compared
+			for (; name_j < talkers_count && talkers_index._nameHash(name_j) == name_hash; ++name_j) {
+				JsonTalker* talker = talkers[talkers_index._nameTalker(name_j)];
+				if (talker != except_talker && strcmp(talker->get_name(), message_to_name) == 0) {
+					talker->_handleTransmission(message, talker_match);
+					return true;
+				}
+			}
+			return false;
+		}
+		#endif
+
+		for (uint8_t talker_i = 0; talker_i < talkers_count; ++talker_i) {
+			if (talkers[talker_i] != except_talker) {
+				const char* talker_name = talkers[talker_i]->get_name();
+				if (strcmp(talker_name, message_to_name) == 0) {
+					talkers[talker_i]->_handleTransmission(message, talker_match);
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+
+protected:
+
+	/**
+     * @brief Checks if a message from a Socket was already seen, remembering it if not
+     * @param message A json message received from a Socket
+     * @return Returns true if it's a duplicate, to be dropped before being routed
+	 *
+     * @note With bridged Sockets and many Repeaters in the same network, the broadcasts may
+	 *       be reflected back, so, a message is identified by its sender, identity, value and
+	 *       content, given that the many-to-one replies share the first three.
+     */
+	bool _isDuplicate(JsonMessage &message) {
+		uint16_t from_hash = message.get_from_hash();
+		if (!from_hash) return false;	// Anonymous messages can't be told apart
+		uint16_t identity = message.get_identity();
+		uint16_t checksum = message._get_checksum();
+		MessageValue message_value = message.get_message_value();
+		const uint16_t local_time = (uint16_t)millis();
+		for (uint8_t seen_i = 0; seen_i < TALKIE_SEEN_MESSAGES; ++seen_i) {
+			const SeenMessage& seen = _seen_messages[seen_i];
+			if (seen.from_hash == from_hash && seen.identity == identity && seen.checksum == checksum
+					&& seen.message_value == message_value
+					&& (uint16_t)(local_time - seen.local_time) <= MAX_NETWORK_PACKET_LIFETIME_MS) {
+				_duplicates_count++;
+				return true;
+			}
+		}
+		// Replaces the oldest one
+		_seen_messages[_next_seen] = { from_hash, identity, checksum, message_value, local_time };
+		_next_seen = (_next_seen + 1) % TALKIE_SEEN_MESSAGES;
+		return false;
+	}
+
+
+	/**
+     * @brief Accounts a message arriving from a Socket before it's routed
+     * @param message A json message received from a Socket
+     * @return Returns false if it's a duplicate, to be dropped
+	 *
+     * @note Socket messages are the interactive traffic, so, while they keep
+	 *       arriving, the Talkers bulk replies are held back.
+     */
+	bool _fromSocket(JsonMessage &message) {
+		#ifdef TALKIE_DEFERRED_BULK
+		_socket_traffic = true;
+		#endif
+		return !_isDuplicate(message);
+	}
+
+
+	#ifdef TALKIE_DEFERRED_BULK
+	/**
+     * @brief Sets the bulk replies budget of the loop about to start
+	 *
+     * @note The bulk replies are held while the previous loop routed Socket traffic,
+	 *       but never for more than `TALKIE_BULK_MAX_HOLD` loops in a row.
+     */
+	void _budgetBulk() {
+		if (_socket_traffic && _bulk_held < TALKIE_BULK_MAX_HOLD) {
+			_bulk_held++;
+			_bulk_budget = 0;
+		} else {
+			_bulk_held = 0;
+			_bulk_budget = TALKIE_BULK_PER_LOOP;
+		}
+		_socket_traffic = false;
+	}
+	#endif
+
 
 public:
 
@@ -90,6 +390,13 @@ public:
 		for (uint8_t talker_i = 0; talker_i < _uplinked_talkers_count; ++talker_i) {
 			_uplinked_talkers[talker_i]->_setLink(this, LinkType::TALKIE_LT_UP_LINKED);
 		}
+		for (uint8_t seen_i = 0; seen_i < TALKIE_SEEN_MESSAGES; ++seen_i) {
+			_seen_messages[seen_i].from_hash = 0;
+		}
+		#ifdef TALKIE_TALKERS_INDEX
+		_downlinked_index._build(_downlinked_talkers, _downlinked_talkers_count);
+		_uplinked_index._build(_uplinked_talkers, _uplinked_talkers_count);
+		#endif
 	}
 
 	~MessageRepeater() {
@@ -110,6 +417,9 @@ public:
 	 * ```
 	 */
     void loop() {
+		#ifdef TALKIE_DEFERRED_BULK
+		_budgetBulk();
+		#endif
 		for (uint8_t socket_j = 0; socket_j < _uplinked_sockets_count; ++socket_j) {
 			_uplinked_sockets[socket_j]->_loop();
 		}
@@ -159,6 +469,30 @@ public:
 	}
 
 
+    /**
+     * @brief Get the total amount of duplicated messages from Sockets already dropped
+     * @return Returns the number of dropped duplicated messages
+     */
+	uint16_t get_duplicates_count() const { return _duplicates_count; }
+
+
+	#ifdef TALKIE_DEFERRED_BULK
+	/**
+     * @brief Takes one bulk reply from the budget of the current loop
+     * @return Returns true if the Talker may transmit its next bulk reply
+	 * 
+     * @note This method being underscored means to be called internally only.
+     */
+	bool _allowBulk() {
+		if (_bulk_budget) {
+			_bulk_budget--;
+			return true;
+		}
+		return false;
+	}
+	#endif
+
+
 	/**
      * @brief Returns the amount of uplinked sockets
 	 * 
@@ -207,6 +541,37 @@ public:
 	}
 
 
+	/**
+     * @brief Keeps the Talkers index consistent with a Talker new channel
+     * @param talker The talker that changed its channel
+     * @param previous_channel The channel the talker had before
+	 *
+     * @note This is intended to be called internally and not by the user code.
+     */
+	void _talkerChannelChanged(const JsonTalker &talker, uint8_t previous_channel) {
+		#ifdef TALKIE_TALKERS_INDEX
+		for (uint8_t talker_i = 0; talker_i < _downlinked_talkers_count; ++talker_i) {
+			if (_downlinked_talkers[talker_i] == &talker) {
+				if (_downlinked_index._isIndexed()) {
+					_downlinked_index._moveChannel(talker_i, previous_channel, talker.get_channel());
+				}
+				return;
+			}
+		}
+		for (uint8_t talker_i = 0; talker_i < _uplinked_talkers_count; ++talker_i) {
+			if (_uplinked_talkers[talker_i] == &talker) {
+				if (_uplinked_index._isIndexed()) {
+					_uplinked_index._moveChannel(talker_i, previous_channel, talker.get_channel());
+				}
+				return;
+			}
+		}
+		#else
+		(void)talker; (void)previous_channel;
+		#endif
+	}
+
+
 	/**
      * @brief Transmits to the Repeater downlink a json message
      * @param socket The socket that is calling the method
@@ -227,6 +592,8 @@ public:
 		Serial.println((int)talker_match);
 		#endif
 
+		if (!_fromSocket(message)) return;
+
 		// To downlinked nodes (BRIDGED uplinks process LOCAL messages too)
 		if (broadcast == BroadcastValue::TALKIE_BC_REMOTE || (broadcast == BroadcastValue::TALKIE_BC_LOCAL && socket.getLinkType() == LinkType::TALKIE_LT_UP_BRIDGED)) {
 			switch (talker_match) {
@@ -241,55 +608,21 @@ public:
 				break;
 				
 				case TalkerMatch::TALKIE_MATCH_BY_CHANNEL:
-				{
-					uint8_t message_channel = message.get_to_channel();
-					for (uint8_t talker_i = 0; talker_i < _downlinked_talkers_count; ++talker_i) {
-						uint8_t talker_channel = _downlinked_talkers[talker_i]->get_channel();
-						if (talker_channel == message_channel) {
-							JsonMessage message_copy(message);
-							_downlinked_talkers[talker_i]->_handleTransmission(message_copy, talker_match);
-						}
-					}
-				}
+				_transmitByChannel(true, message, talker_match);
 				break;
 				
 				case TalkerMatch::TALKIE_MATCH_BY_NAME:
 				
-				#ifdef MESSAGE_DEBUG_TIMING
-				Serial.print(" | ");
-				Serial.print(millis() - message._reference_time);
-				#endif
-				
-				{
-					char message_to_name[TALKIE_NAME_LEN];
-					strcpy(message_to_name, message.get_to_name());
-					for (uint8_t talker_i = 0; talker_i < _downlinked_talkers_count; ++talker_i) {
-						const char* talker_name = _downlinked_talkers[talker_i]->get_name();
-						if (strcmp(talker_name, message_to_name) == 0) {
-							_downlinked_talkers[talker_i]->_handleTransmission(message, talker_match);
-							return;
-						}
-					}
-				}
+				if (_transmitByName(true, message, talker_match)) return;
 				break;
 
 				default: return;
 			}
 			
-			#ifdef MESSAGE_DEBUG_TIMING
-			Serial.print(" | ");
-			Serial.print(millis() - message._reference_time);
-			#endif
-				
 			for (uint8_t socket_j = 0; socket_j < _downlinked_sockets_count; ++socket_j) {
 				// Sockets ONLY manipulate the checksum ('c')
 				_downlinked_sockets[socket_j]->_finishTransmission(message);
 			}
-			
-			#ifdef MESSAGE_DEBUG_TIMING
-			Serial.print(" | ");
-			Serial.print(millis() - message._reference_time);
-			#endif
 		}
 	}
 
@@ -330,30 +663,11 @@ public:
 					break;
 					
 					case TalkerMatch::TALKIE_MATCH_BY_CHANNEL:
-					{
-						uint8_t message_channel = message.get_to_channel();
-						for (uint8_t talker_i = 0; talker_i < _uplinked_talkers_count; ++talker_i) {
-							uint8_t talker_channel = _uplinked_talkers[talker_i]->get_channel();
-							if (talker_channel == message_channel) {
-								JsonMessage message_copy(message);
-								_uplinked_talkers[talker_i]->_handleTransmission(message_copy, talker_match);
-							}
-						}
-					}
+					_transmitByChannel(false, message, talker_match);
 					break;
 					
 					case TalkerMatch::TALKIE_MATCH_BY_NAME:
-					{
-						char message_to_name[TALKIE_NAME_LEN];
-						strcpy(message_to_name, message.get_to_name());
-						for (uint8_t talker_i = 0; talker_i < _uplinked_talkers_count; ++talker_i) {
-							const char* talker_name = _uplinked_talkers[talker_i]->get_name();
-							if (strcmp(talker_name, message_to_name) == 0) {
-								_uplinked_talkers[talker_i]->_handleTransmission(message, talker_match);
-								return true;
-							}
-						}
-					}
+					if (_transmitByName(false, message, talker_match)) return true;
 					break;
 
 					case TalkerMatch::TALKIE_MATCH_NONE: return true;
@@ -389,34 +703,11 @@ public:
 						break;
 						
 						case TalkerMatch::TALKIE_MATCH_BY_CHANNEL:
-						{
-							uint8_t message_channel = message.get_to_channel();
-							for (uint8_t talker_i = 0; talker_i < _downlinked_talkers_count; ++talker_i) {
-								if (_downlinked_talkers[talker_i] != &talker) {
-									uint8_t talker_channel = _downlinked_talkers[talker_i]->get_channel();
-									if (talker_channel == message_channel) {
-										JsonMessage message_copy(message);
-										_downlinked_talkers[talker_i]->_handleTransmission(message_copy, talker_match);
-									}
-								}
-							}
-						}
+						_transmitByChannel(true, message, talker_match, &talker);
 						break;
 						
 						case TalkerMatch::TALKIE_MATCH_BY_NAME:
-						{
-							char message_to_name[TALKIE_NAME_LEN];
-							strcpy(message_to_name, message.get_to_name());
-							for (uint8_t talker_i = 0; talker_i < _downlinked_talkers_count; ++talker_i) {
-								if (_downlinked_talkers[talker_i] != &talker) {
-									const char* talker_name = _downlinked_talkers[talker_i]->get_name();
-									if (strcmp(talker_name, message_to_name) == 0) {
-										_downlinked_talkers[talker_i]->_handleTransmission(message, talker_match);
-										return true;
-									}
-								}
-							}
-						}
+						if (_transmitByName(true, message, talker_match, &talker)) return true;
 						break;
 						
 						case TalkerMatch::TALKIE_MATCH_NONE: return true;
@@ -528,6 +819,8 @@ public:
 		Serial.println((int)broadcast);
 		#endif
 
+		if (!_fromSocket(message)) return;
+
 		switch (broadcast) {
 
 			case BroadcastValue::TALKIE_BC_REMOTE:		// To uplinked nodes
@@ -544,55 +837,21 @@ public:
 					break;
 					
 					case TalkerMatch::TALKIE_MATCH_BY_CHANNEL:
-					{
-						uint8_t message_channel = message.get_to_channel();
-						for (uint8_t talker_i = 0; talker_i < _uplinked_talkers_count; ++talker_i) {
-							uint8_t talker_channel = _uplinked_talkers[talker_i]->get_channel();
-							if (talker_channel == message_channel) {
-								JsonMessage message_copy(message);
-								_uplinked_talkers[talker_i]->_handleTransmission(message_copy, talker_match);
-							}
-						}
-					}
+					_transmitByChannel(false, message, talker_match);
 					break;
 					
 					case TalkerMatch::TALKIE_MATCH_BY_NAME:
 					
-					#ifdef MESSAGE_DEBUG_TIMING
-					Serial.print(" | ");
-					Serial.print(millis() - message._reference_time);
-					#endif
-				
-					{
-						char message_to_name[TALKIE_NAME_LEN];
-						strcpy(message_to_name, message.get_to_name());
-						for (uint8_t talker_i = 0; talker_i < _uplinked_talkers_count; ++talker_i) {
-							const char* talker_name = _uplinked_talkers[talker_i]->get_name();
-							if (strcmp(talker_name, message_to_name) == 0) {
-								_uplinked_talkers[talker_i]->_handleTransmission(message, talker_match);
-								return;
-							}
-						}
-					}
+					if (_transmitByName(false, message, talker_match)) return;
 					break;
 					
 					default: return;
 				}
 				
-				#ifdef MESSAGE_DEBUG_TIMING
-				Serial.print(" | ");
-				Serial.print(millis() - message._reference_time);
-				#endif
-				
 				for (uint8_t socket_j = 0; socket_j < _uplinked_sockets_count; ++socket_j) {
 					// Sockets ONLY manipulate the checksum ('c')
 					_uplinked_sockets[socket_j]->_finishTransmission(message);
 				}
-				
-				#ifdef MESSAGE_DEBUG_TIMING
-				Serial.print(" | ");
-				Serial.print(millis() - message._reference_time);
-				#endif
 			}
 			break;
 			
@@ -611,30 +870,11 @@ public:
 					break;
 					
 					case TalkerMatch::TALKIE_MATCH_BY_CHANNEL:
-					{
-						uint8_t message_channel = message.get_to_channel();
-						for (uint8_t talker_i = 0; talker_i < _downlinked_talkers_count; ++talker_i) {
-							uint8_t talker_channel = _downlinked_talkers[talker_i]->get_channel();
-							if (talker_channel == message_channel) {
-								JsonMessage message_copy(message);
-								_downlinked_talkers[talker_i]->_handleTransmission(message_copy, talker_match);
-							}
-						}
-					}
+					_transmitByChannel(true, message, talker_match);
 					break;
 					
 					case TalkerMatch::TALKIE_MATCH_BY_NAME:
-					{
-						char message_to_name[TALKIE_NAME_LEN];
-						strcpy(message_to_name, message.get_to_name());
-						for (uint8_t talker_i = 0; talker_i < _downlinked_talkers_count; ++talker_i) {
-							const char* talker_name = _downlinked_talkers[talker_i]->get_name();
-							if (strcmp(talker_name, message_to_name) == 0) {
-								_downlinked_talkers[talker_i]->_handleTransmission(message, talker_match);
-								return;
-							}
-						}
-					}
+					if (_transmitByName(true, message, talker_match)) return;
 					break;
 					
 					default: return;
@@ -704,30 +944,11 @@ public:
 					break;
 					
 					case TalkerMatch::TALKIE_MATCH_BY_CHANNEL:
-					{
-						uint8_t message_channel = message.get_to_channel();
-						for (uint8_t talker_i = 0; talker_i < _downlinked_talkers_count; ++talker_i) {
-							uint8_t talker_channel = _downlinked_talkers[talker_i]->get_channel();
-							if (talker_channel == message_channel) {
-								JsonMessage message_copy(message);
-								_downlinked_talkers[talker_i]->_handleTransmission(message_copy, talker_match);
-							}
-						}
-					}
+					_transmitByChannel(true, message, talker_match);
 					break;
 					
 					case TalkerMatch::TALKIE_MATCH_BY_NAME:
-					{
-						char message_to_name[TALKIE_NAME_LEN];
-						strcpy(message_to_name, message.get_to_name());
-						for (uint8_t talker_i = 0; talker_i < _downlinked_talkers_count; ++talker_i) {
-							const char* talker_name = _downlinked_talkers[talker_i]->get_name();
-							if (strcmp(talker_name, message_to_name) == 0) {
-								_downlinked_talkers[talker_i]->_handleTransmission(message, talker_match);
-								return true;
-							}
-						}
-					}
+					if (_transmitByName(true, message, talker_match)) return true;
 					break;
 					
 					case TalkerMatch::TALKIE_MATCH_NONE: return true;
@@ -21,6 +21,18 @@ https://github.com/ruiseixasm/JsonTalkie
 #define BUZZ_PIN 3	// External BLACK pin
 
 
+// The Actions are kept in flash (PROGMEM), sparing their RAM on AVR boards
+const char black_buzz_name[] PROGMEM = "buzz";
+const char black_buzz_desc[] PROGMEM = "Buzz for a while";
+const char black_ms_name[] PROGMEM = "ms";
+const char black_ms_desc[] PROGMEM = "Gets and sets the buzzing duration";
+// ALWAYS MAKE SURE THE DIMENSIONS OF THE ARRAYS BELOW ARE THE CORRECT!
+const Action black_calls[2] PROGMEM = {
+	{black_buzz_name, black_buzz_desc},
+	{black_ms_name, black_ms_desc}
+};
+
+
 class BlackManifesto : public TalkerManifesto {
 public:
 
@@ -34,19 +46,13 @@ protected:
     uint16_t _buzz_duration_ms = 100;
 	uint16_t _buzz_start = 0;
 
-	// ALWAYS MAKE SURE THE DIMENSIONS OF THE ARRAYS BELOW ARE THE CORRECT!
-
-    Action calls[2] = {
-		{"buzz", "Buzz for a while"},
-		{"ms", "Gets and sets the buzzing duration"}
-    };
-    
 public:
 
-    const Action* _getActionsArray() const override { return calls; }
+    const Action* _getActionsArray() const override { return black_calls; }
 
     // Size methods
-    uint8_t _actionsCount() const override { return sizeof(calls)/sizeof(Action); }
+    uint8_t _actionsCount() const override { return sizeof(black_calls)/sizeof(Action); }
+    bool _actionsInFlash() const override { return true; }
 
 
 	void _loop(JsonTalker& talker) override {
@@ -23,9 +23,9 @@ https://github.com/ruiseixasm/JsonTalkie
 #include "src/MessageRepeater.hpp"
 
 const char mega_name[] = "mega";
-const char mega_desc[] = "I'm a Mega talker";
+const char mega_desc[] PROGMEM = "I'm a Mega talker";
 MegaManifesto mega_manifesto;
-JsonTalker mega = JsonTalker(mega_name, mega_desc, &mega_manifesto);
+JsonTalker mega = JsonTalker(mega_name, FPSTR(mega_desc), &mega_manifesto);
 
 JsonTalker* downlinked_talkers[] = { &mega };    // Only an array of pointers preserves polymorphism!!
 // Singleton requires the & (to get a reference variable)
@@ -23,6 +23,16 @@ void JsonTalker::_setLink(MessageRepeater* message_repeater, LinkType link_type)
 }
 
 
+void JsonTalker::set_channel(uint8_t channel) {
+	uint8_t previous_channel = _channel;
+	_channel = channel;
+	// The Repeater indexes its Talkers by channel
+	if (_message_repeater && previous_channel != channel) {
+		_message_repeater->_talkerChannelChanged(*this, previous_channel);
+	}
+}
+
+
 bool JsonTalker::transmitToRepeater(JsonMessage& json_message) {
 
 	#ifdef JSON_TALKER_DEBUG_NEW
@@ -32,6 +42,11 @@ bool JsonTalker::transmitToRepeater(JsonMessage& json_message) {
 	#endif
 
 	if (_message_repeater && _prepareMessage(json_message)) {
+
+		#ifdef TALKIE_TRACE
+		TalkieTrace::instance()._record(TalkieTrace::Hop::TALKIE_HOP_TRANSMITTED, _trace_node, json_message);
+		#endif
+
 		switch (_link_type) {
 			case LinkType::TALKIE_LT_UP_LINKED:
 			case LinkType::TALKIE_LT_UP_BRIDGED:
@@ -68,6 +83,14 @@ BroadcastSocket* JsonTalker::_getSocket(uint8_t socket_index) {
 }
 
 
+uint16_t JsonTalker::_duplicatesCount() {
+	if (_message_repeater) {
+		return _message_repeater->get_duplicates_count();
+	}
+	return 0;
+}
+
+
 const char* JsonTalker::_manifesto_name() const {
 	if (_manifesto) {
 		return _manifesto->class_name();
@@ -77,10 +100,81 @@ const char* JsonTalker::_manifesto_name() const {
 
 
 void JsonTalker::_loop() {
+	#ifdef TALKIE_DEFERRED_BULK
+	if (_bulkPending()) _releaseBulk();
+	#endif
+	if (get_pending()) _replyPending();
 	if (_manifesto) _manifesto->_loop(*this);
 }
 
 
+void JsonTalker::_keepCaller(JsonMessage& json_message) {
+	_pending_reply = !(_muted_calls || json_message.is_no_reply());
+	_pending_broadcast = json_message.get_broadcast_value();
+	_pending_action_type = json_message.get_action_type();
+	_pending_identity = json_message.get_identity();
+	const char* from_name = json_message.get_from_name();
+	strncpy(_pending_caller, from_name ? from_name : "", TALKIE_NAME_LEN - 1);
+	_pending_caller[TALKIE_NAME_LEN - 1] = '\0';
+}
+
+
+void JsonTalker::_replyPending() {
+	JsonMessage json_message;
+	ActionState action_state = _pollAction(_pending_action, json_message);
+	if (action_state == ActionState::TALKIE_AS_PENDING) return;
+	// Rebuilds the echo of the original call with its identity
+	json_message.set_message_value(MessageValue::TALKIE_MSG_ECHO);
+	json_message.set_broadcast_value(_pending_broadcast);
+	json_message.set_identity(_pending_identity);
+	json_message.set_from_name(_name);	// Avoids the swapping
+	json_message.set_to_name(_pending_caller);
+	if (_pending_action_type == ValueType::TALKIE_VT_STRING) {
+		_setActionName(json_message, _pending_action);
+	} else {
+		json_message.set_action_index(_pending_action);
+	}
+	if (action_state != ActionState::TALKIE_AS_ROGER) {
+		json_message.set_roger_value(RogerValue::TALKIE_RGR_NEGATIVE);
+	}
+	_pending_action = 255;	// Frees it before the reply, that may start another Action
+	if (_pending_reply) transmitToRepeater(json_message);
+}
+
+
+#ifdef TALKIE_DEFERRED_BULK
+void JsonTalker::_releaseBulk() {
+	// The Repeater holds the bulk replies while there is Socket traffic to be routed
+	if (!(_message_repeater && _message_repeater->_allowBulk())) return;
+	switch (_bulk_value) {
+
+		case MessageValue::TALKIE_MSG_LIST:
+			if (_bulk_next < _actionsCount()) {	// This makes the access safe
+				_setListedAction(_bulk_message, _bulk_next);
+				transmitToRepeater(_bulk_message);	// Many-to-One
+			}
+			break;
+
+		case MessageValue::TALKIE_MSG_TALK:
+			_setDesc(_bulk_message);
+			transmitToRepeater(_bulk_message);		// One-to-One
+			break;
+
+		#ifdef TALKIE_TRACE
+		case MessageValue::TALKIE_MSG_SYSTEM:	// The trace, kept paused while being released
+			_setTraceEvent(_bulk_message, _bulk_next);
+			transmitToRepeater(_bulk_message);		// Many-to-One
+			if (_bulk_next + 1 == _bulk_total) TalkieTrace::instance().set_paused(false);
+			break;
+		#endif
+
+		default: break;
+	}
+	_bulk_next++;
+}
+#endif
+
+
 uint8_t JsonTalker::_actionsCount() const {
 	if (_manifesto) {
 		return _manifesto->_actionsCount();
@@ -88,13 +182,51 @@ uint8_t JsonTalker::_actionsCount() const {
 	return 0;
 }
 
-const Action* JsonTalker::_getActionsArray() const {
+void JsonTalker::_setActionName(JsonMessage& json_message, uint8_t index) const {
 	if (_manifesto) {
-		return _manifesto->_getActionsArray();
+		Action action = _manifesto->_getAction(index);
+		if (_manifesto->_actionsInFlash()) {
+			json_message.set_action_name(FPSTR(action.name));
+		} else {
+			json_message.set_action_name(action.name);
+		}
 	}
-	return nullptr;
 }
 
+void JsonTalker::_setListedAction(JsonMessage& json_message, uint8_t index) const {
+	if (_manifesto) {
+		Action action = _manifesto->_getAction(index);
+		json_message.remove_all_nth_values();	// Makes sure there is space for each new action
+		json_message.set_nth_value_number(0, index);
+		if (_manifesto->_actionsInFlash()) {
+			json_message.set_nth_value_string(1, FPSTR(action.name));
+			json_message.set_nth_value_string(2, FPSTR(action.desc));
+		} else {
+			json_message.set_nth_value_string(1, action.name);
+			json_message.set_nth_value_string(2, action.desc);
+		}
+	}
+}
+
+void JsonTalker::_setDesc(JsonMessage& json_message) const {
+	if (_desc_in_flash) {
+		json_message.set_nth_value_string(0, FPSTR(_desc));
+	} else {
+		json_message.set_nth_value_string(0, _desc);
+	}
+}
+
+#ifdef TALKIE_TRACE
+void JsonTalker::_setTraceEvent(JsonMessage& json_message, uint8_t event_i) const {
+	const TalkieTrace::Event& event = TalkieTrace::instance().get_event(event_i);
+	json_message.set_nth_value_number(0, event.time_us);
+	json_message.set_nth_value_number(1, static_cast<uint32_t>(event.hop));
+	json_message.set_nth_value_number(2, event.node);
+	json_message.set_nth_value_number(3, static_cast<uint32_t>(event.message_value));
+	json_message.set_nth_value_number(4, event.identity);
+}
+#endif
+
 
 uint8_t JsonTalker::_actionIndex(const char* name) const {
 	if (_manifesto) {
@@ -110,11 +242,18 @@ uint8_t JsonTalker::_actionIndex(uint8_t index) const {
 	return 255;
 }
 
-bool JsonTalker::_actionByIndex(uint8_t index, JsonMessage& json_message, TalkerMatch talker_match) {
+ActionState JsonTalker::_startAction(uint8_t index, JsonMessage& json_message, TalkerMatch talker_match) {
 	if (_manifesto) {
-		return _manifesto->_actionByIndex(index, *this, json_message, talker_match);
+		return _manifesto->_startAction(index, *this, json_message, talker_match);
 	}
-	return false;
+	return ActionState::TALKIE_AS_NEGATIVE;
+}
+
+ActionState JsonTalker::_pollAction(uint8_t index, JsonMessage& json_message) {
+	if (_manifesto) {
+		return _manifesto->_pollAction(index, *this, json_message);
+	}
+	return ActionState::TALKIE_AS_NEGATIVE;
 }
 
 
@@ -0,0 +1,175 @@
+/*
+JsonTalkie - Json Talkie is intended for direct IoT communication.
+Original Copyright (c) 2025 Rui Seixas Monteiro. All right reserved.
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Lesser General Public License for more details.
+https://github.com/ruiseixasm/JsonTalkie
+*/
+
+
+/**
+ * @file TalkieTrace.hpp
+ * @brief A ring of binary events recorded at each hop of a message, for latency analysis.
+ *
+ * @author Rui Seixas Monteiro
+ * @date Created: 2026-10-18
+ * @version 1.0.0
+ */
+
+#ifndef TALKIE_TRACE_HPP
+#define TALKIE_TRACE_HPP
+
+#include <Arduino.h>        // Needed for Serial given that Arduino IDE only includes Serial in .ino files!
+#include "JsonMessage.hpp"
+
+
+// #define TALKIE_TRACE
+
+#ifdef __AVR__
+#define TALKIE_TRACE_EVENTS 16		///< Events kept in the ring, the oldest are overwritten (power of 2)
+#else
+#define TALKIE_TRACE_EVENTS 128		///< Events kept in the ring, the oldest are overwritten (power of 2)
+#endif
+
+
+/**
+ * @class TalkieTrace
+ * @brief Records fixed size events, with a microseconds timestamp, in a RAM ring buffer
+ *
+ * Enabled with `TALKIE_TRACE`, each hop of a message, from the Socket that received it, through the
+ * Talkers, up to the Sockets that sent it, records the Socket or Talker name hash, the message value
+ * and identity. The replies keep the identity of their requests, so, the tool `talkie_trace.py`
+ * pairs both in a per hop latency breakdown of each message.
+ *
+ * @note There is a single copy of the tool, shared by all sketches, in `JsonMidiCreator/TalkieEthernetENC_SPI/extras`.
+ *
+ * @note Recording takes a few microseconds and no printing, the events are only dumped on demand,
+ *       with `dump` to Serial or with the `system trace` command.
+ */
+class TalkieTrace {
+public:
+
+	/**
+	 * @brief The point in the message path where an event is recorded
+	 */
+	enum class Hop : uint8_t {
+		TALKIE_HOP_RECEIVED,	///< A Socket received the message
+		TALKIE_HOP_HANDLED,		///< A Talker started to handle the message
+		TALKIE_HOP_TRANSMITTED,	///< A Talker transmitted the message to the Repeater
+		TALKIE_HOP_SENDING,		///< A Socket is about to send the message
+		TALKIE_HOP_SENT			///< A Socket sent the message
+	};
+
+	/**
+	 * @brief A recorded event, with the node being the name hash of the Talker or Socket class
+	 */
+	struct Event {
+		uint32_t time_us;
+		uint16_t node;
+		uint16_t identity;
+		Hop hop;
+		MessageValue message_value;
+	};
+
+
+private:
+
+	Event _events[TALKIE_TRACE_EVENTS];
+	uint16_t _recorded = 0;		// Total events recorded, the next one goes at its ring position
+	bool _paused = false;
+
+	TalkieTrace() = default;
+
+
+public:
+
+    TalkieTrace(const TalkieTrace&) = delete;
+    TalkieTrace& operator=(const TalkieTrace&) = delete;
+
+    static TalkieTrace& instance() {
+        static TalkieTrace instance;
+        return instance;
+    }
+
+
+    /**
+     * @brief Records an event, overwriting the oldest one when the ring is full
+     * @param hop The point in the message path
+     * @param node The name hash of the Talker or of the Socket class, hashed once by its owner
+     * @param json_message The message going through the hop
+     */
+	void _record(Hop hop, uint16_t node, JsonMessage& json_message) {
+		if (_paused) return;
+		Event& event = _events[_recorded & (TALKIE_TRACE_EVENTS - 1)];
+		event.time_us = micros();
+		event.node = node;
+		event.identity = json_message.get_identity();
+		event.hop = hop;
+		event.message_value = json_message.get_message_value();
+		_recorded++;
+	}
+
+
+    /**
+     * @brief Get the amount of events available in the ring
+     */
+	uint8_t get_events_count() const {
+		return _recorded < TALKIE_TRACE_EVENTS ? (uint8_t)_recorded : TALKIE_TRACE_EVENTS;
+	}
+
+
+    /**
+     * @brief Get an event, from the oldest (0) to the most recent one
+     * @param event_i The age order of the event, up to `get_events_count()`
+     */
+	const Event& get_event(uint8_t event_i) const {
+		uint16_t oldest = _recorded < TALKIE_TRACE_EVENTS ? 0 : _recorded - TALKIE_TRACE_EVENTS;
+		return _events[(oldest + event_i) & (TALKIE_TRACE_EVENTS - 1)];
+	}
+
+
+    /**
+     * @brief Stops or resumes the recording, like while the events are being dumped
+     */
+	void set_paused(bool paused) { _paused = paused; }
+
+
+    /**
+     * @brief Discards all recorded events
+     */
+	void clear() { _recorded = 0; }
+
+
+    /**
+     * @brief Prints all events, the oldest first, one per line as `T,time_us,hop,node,message,identity`
+     * @param out Where to print, like `Serial`
+     */
+	void dump(Print& out) {
+		bool paused = _paused;
+		_paused = true;
+		for (uint8_t event_i = 0; event_i < get_events_count(); ++event_i) {
+			const Event& event = get_event(event_i);
+			out.print(F("T,"));
+			out.print(event.time_us);
+			out.print(',');
+			out.print(static_cast<int>(event.hop));
+			out.print(',');
+			out.print(event.node);
+			out.print(',');
+			out.print(static_cast<int>(event.message_value));
+			out.print(',');
+			out.println(event.identity);
+		}
+		_paused = paused;
+	}
+
+};
+
+
+#endif // TALKIE_TRACE_HPP
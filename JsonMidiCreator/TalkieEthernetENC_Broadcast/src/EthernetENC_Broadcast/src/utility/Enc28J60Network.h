@@ -78,6 +78,10 @@ public:
   static void powerOff();
   static bool linkStatus();
 
+  // Multicast frames only pass for the given group MAC (and the all hosts one)
+  static void enableMulticastFilter(const uint8_t* group_mac);
+  static void disableMulticastFilter();
+
   static void setCsPin(uint8_t _csPin) {csPin = _csPin;}
   static void initSPI();
   static bool init(uint8_t* macaddr);
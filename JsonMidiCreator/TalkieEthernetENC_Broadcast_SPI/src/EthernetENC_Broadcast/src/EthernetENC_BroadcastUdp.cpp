@@ -56,10 +56,36 @@ UIPUDP::begin(uint16_t port)
   return 0;
 }
 
+// initialize, start listening on specified port and join the multicast group.
+// Returns 1 if successful, 0 if there are no sockets available to use or the ip isn't multicast
+uint8_t
+UIPUDP::beginMulticast(IPAddress ip, uint16_t port)
+{
+  if ((ip[0] & 0xF0) != 0xE0 || !begin(port))
+    return 0;
+
+  uip_ip_addr(uip_mcastaddr, ip);
+  const uint8_t group_mac[6] = {0x01, 0x00, 0x5e, (uint8_t)(ip[1] & 0x7F), ip[2], ip[3]};
+  Enc28J60Network::enableMulticastFilter(group_mac);
+
+  // Unsolicited report, so snooping switches start forwarding the group right away
+  UIPEthernetENC_BroadcastClass::tick();
+  uip_igmp_report();
+  uip_arp_out();
+  UIPEthernetENC_BroadcastClass::network_send();
+  uip_len = 0;
+  return 1;
+}
+
 // Finish with the UDP socket
 void
 UIPUDP::stop()
 {
+  if (uip_mcastaddr[0] || uip_mcastaddr[1])
+    {
+      uip_mcastaddr[0] = uip_mcastaddr[1] = 0;
+      Enc28J60Network::disableMulticastFilter();
+    }
   if (_uip_udp_conn)
     {
       uip_udp_remove(_uip_udp_conn);
@@ -59,6 +59,8 @@ public:
   EthernetENC_BroadcastUDP();  // Constructor
   uint8_t
   begin(uint16_t);// initialize, start listening on specified port. Returns 1 if successful, 0 if there are no sockets available to use
+  uint8_t
+  beginMulticast(IPAddress, uint16_t);// like begin, also joining (IGMPv2) the multicast group. Only one group at a time
   void
   stop();  // Finish with the UDP socket
 
@@ -645,6 +645,58 @@ Enc28J60Network::powerOn()
   SPI.endTransaction();
 }
 
+// Hash table bit of a destination MAC address, being the CRC-32 bits 28:23
+// as per the ENC28J60 datasheet (section 8.3.1)
+static uint8_t
+multicastHashIndex(const uint8_t* mac)
+{
+  uint32_t crc = 0xFFFFFFFF;
+  for (uint8_t i = 0; i < 6; i++)
+    {
+      uint8_t data = mac[i];
+      for (uint8_t j = 0; j < 8; j++)
+        {
+          bool carry = ((crc >> 31) ^ (data & 0x01)) != 0;
+          crc <<= 1;
+          if (carry)
+            crc ^= 0x04C11DB7;
+          data >>= 1;
+        }
+    }
+  return (crc >> 23) & 0x3F;
+}
+
+void
+Enc28J60Network::enableMulticastFilter(const uint8_t* group_mac)
+{
+  static const uint8_t all_hosts_mac[6] = {0x01, 0x00, 0x5e, 0x00, 0x00, 0x01};  // 224.0.0.1, IGMP queries
+  uint8_t hash_table[8] = {0};
+  uint8_t index = multicastHashIndex(group_mac);
+  hash_table[index >> 3] |= 1 << (index & 0x07);
+  index = multicastHashIndex(all_hosts_mac);
+  hash_table[index >> 3] |= 1 << (index & 0x07);
+
+  SPI.beginTransaction(SPI_ETHERNET_SETTINGS);
+  writeOp(ENC28J60_BIT_FIELD_CLR, ECON1, ECON1_RXEN);
+  for (uint8_t i = 0; i < 8; i++)
+    writeReg(EHT0 + i, hash_table[i]);
+  // Any multicast (MCEN) gives place to the hashed ones (HTEN), so non member
+  // frames are rejected by the chip instead of being read by receivePacket
+  writeReg(ERXFCON, ERXFCON_UCEN | ERXFCON_CRCEN | ERXFCON_BCEN | ERXFCON_HTEN);
+  writeOp(ENC28J60_BIT_FIELD_SET, ECON1, ECON1_RXEN);
+  SPI.endTransaction();
+}
+
+void
+Enc28J60Network::disableMulticastFilter()
+{
+  SPI.beginTransaction(SPI_ETHERNET_SETTINGS);
+  writeOp(ENC28J60_BIT_FIELD_CLR, ECON1, ECON1_RXEN);
+  writeReg(ERXFCON, ERXFCON_UCEN | ERXFCON_CRCEN | ERXFCON_BCEN | ERXFCON_MCEN);
+  writeOp(ENC28J60_BIT_FIELD_SET, ECON1, ECON1_RXEN);
+  SPI.endTransaction();
+}
+
 bool
 Enc28J60Network::linkStatus()
 {
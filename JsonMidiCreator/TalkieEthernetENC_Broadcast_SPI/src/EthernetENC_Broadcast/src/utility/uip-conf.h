@@ -155,6 +155,13 @@ typedef unsigned short uip_stats_t;
  */
 #define UIP_CONF_BROADCAST    1
 
+/**
+ * IP Multicast (receive of one IGMP joined group) on or off
+ * (see EthernetENC_BroadcastUDP::beginMulticast)
+ * \hideinitializer
+ */
+#define UIP_CONF_MULTICAST    1
+
 
 /**
  * uIP statistics on or off
@@ -123,6 +123,15 @@ static const uip_ipaddr_t all_zeroes_addr =
   {0x0000,0x0000};
 #endif /* UIP_CONF_IPV6 */
 
+#if UIP_CONF_MULTICAST && !UIP_CONF_IPV6
+uip_ipaddr_t uip_mcastaddr;
+
+#define IGMP_MEMBERSHIP_QUERY     0x11
+#define IGMP_V2_MEMBERSHIP_REPORT 0x16
+#define IGMP_REPORT_IPH_LEN       24    /* IP header with the Router Alert option */
+#define IGMP_LEN                  8
+#endif /* UIP_CONF_MULTICAST */
+
 
 #if UIP_FIXEDETHADDR
 const struct uip_eth_addr uip_ethaddr = {{UIP_ETHADDR0,
@@ -325,6 +334,61 @@ uip_ipchksum(void)
 }
 #endif
 /*---------------------------------------------------------------------------*/
+#if UIP_CONF_MULTICAST && !UIP_CONF_IPV6
+static u16_t
+igmp_chksum(const u8_t *data, u8_t len)
+{
+  uint32_t sum = 0;
+  for(; len > 1; len -= 2, data += 2) {
+    sum += (data[0] << 8) | data[1];
+  }
+  while(sum >> 16) {
+    sum = (sum & 0xffff) + (sum >> 16);
+  }
+  return ~sum;
+}
+/*---------------------------------------------------------------------------*/
+void
+uip_igmp_report(void)
+{
+  u8_t *ip = &uip_buf[UIP_LLH_LEN];
+  u8_t *igmp = ip + IGMP_REPORT_IPH_LEN;
+  u16_t sum;
+
+  /* IGMPv2 report, sent to the group itself (RFC 2236) */
+  igmp[0] = IGMP_V2_MEMBERSHIP_REPORT;
+  igmp[1] = 0;
+  igmp[2] = igmp[3] = 0;
+  memcpy(&igmp[4], uip_mcastaddr, 4);
+  sum = igmp_chksum(igmp, IGMP_LEN);
+  igmp[2] = sum >> 8;
+  igmp[3] = sum & 0xff;
+
+  ip[0] = 0x46;                     /* IPv4, 24 bytes header */
+  ip[1] = 0xc0;                     /* Internetwork control */
+  ip[2] = 0;
+  ip[3] = IGMP_REPORT_IPH_LEN + IGMP_LEN;
+  ++ipid;
+  ip[4] = ipid >> 8;
+  ip[5] = ipid & 0xff;
+  ip[6] = ip[7] = 0;
+  ip[8] = 1;                        /* TTL, never routed */
+  ip[9] = UIP_PROTO_IGMP;
+  ip[10] = ip[11] = 0;
+  memcpy(&ip[12], uip_hostaddr, 4);
+  memcpy(&ip[16], uip_mcastaddr, 4);
+  ip[20] = 0x94;                    /* Router Alert option (RFC 2113) */
+  ip[21] = 0x04;
+  ip[22] = ip[23] = 0;
+  sum = igmp_chksum(ip, IGMP_REPORT_IPH_LEN);
+  ip[10] = sum >> 8;
+  ip[11] = sum & 0xff;
+
+  uip_len = IGMP_REPORT_IPH_LEN + IGMP_LEN;
+  uip_flags = 0;
+}
+#endif /* UIP_CONF_MULTICAST */
+/*---------------------------------------------------------------------------*/
 static u16_t
 upper_layer_chksum(u8_t proto)
 {
@@ -837,6 +901,22 @@ uip_process(u8_t flag)
     goto drop;
   }
 #else /* UIP_CONF_IPV6 */
+#if UIP_CONF_MULTICAST
+  /* IGMP queries carry the Router Alert option, so they have to be
+     answered before the header length check drops them. */
+  if(BUF->proto == UIP_PROTO_IGMP) {
+    u8_t *igmp = &uip_buf[UIP_LLH_LEN + ((BUF->vhl & 0x0f) << 2)];
+    if(igmp[0] == IGMP_MEMBERSHIP_QUERY &&
+       !uip_ipaddr_cmp(uip_mcastaddr, all_zeroes_addr) &&
+       ((igmp[4] | igmp[5] | igmp[6] | igmp[7]) == 0 ||	/* General query */
+        memcmp(&igmp[4], uip_mcastaddr, 4) == 0)) {	/* Group query */
+      uip_igmp_report();
+      return;
+    }
+    goto drop;
+  }
+#endif /* UIP_CONF_MULTICAST */
+
   /* Check validity of the IP header. */
   if(BUF->vhl != 0x45)  { /* IP version and header length. */
     UIP_STAT(++uip_stat.ip.drop);
@@ -914,6 +994,13 @@ uip_process(u8_t flag)
 	 uip_ipchksum() == 0xffff*/) {
       goto udp_input;
     }
+#if UIP_CONF_MULTICAST
+    if(BUF->proto == UIP_PROTO_UDP &&
+       !uip_ipaddr_cmp(uip_mcastaddr, all_zeroes_addr) &&
+       uip_ipaddr_cmp(BUF->destipaddr, uip_mcastaddr)) {
+      goto udp_input;
+    }
+#endif /* UIP_CONF_MULTICAST */
 #endif /* UIP_BROADCAST */
     
     /* Check if the packet is destined for our IP address. */
@@ -1507,6 +1507,7 @@ struct uip_udpip_hdr {
 
 
 #define UIP_PROTO_ICMP  1
+#define UIP_PROTO_IGMP  2
 #define UIP_PROTO_TCP   6
 #define UIP_PROTO_UDP   17
 #define UIP_PROTO_ICMP6 58
@@ -1534,6 +1535,24 @@ extern const uip_ipaddr_t uip_hostaddr, uip_netmask, uip_draddr;
 extern uip_ipaddr_t uip_hostaddr, uip_netmask, uip_draddr;
 #endif /* UIP_FIXEDADDR */
 
+#if UIP_CONF_MULTICAST && !UIP_CONF_IPV6
+/**
+ * The IP multicast group joined by the host, all zeroes when none.
+ *
+ * UDP packets sent to this group are accepted like the broadcasted
+ * ones, and IGMP membership queries for it are answered.
+ */
+extern uip_ipaddr_t uip_mcastaddr;
+
+/**
+ * Builds an IGMPv2 membership report for uip_mcastaddr in uip_buf.
+ *
+ * On return uip_len holds the length of the IP packet, that still
+ * needs uip_arp_out() to get its Ethernet header before being sent.
+ */
+void uip_igmp_report(void);
+#endif /* UIP_CONF_MULTICAST */
+
 
 
 /**
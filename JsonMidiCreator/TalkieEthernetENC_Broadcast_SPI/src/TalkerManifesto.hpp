@@ -39,10 +39,142 @@ using ErrorValue 		= TalkieCodes::ErrorValue;
 using ValueType 		= TalkieCodes::ValueType;
 using Original 			= JsonMessage::Original;
 using Action 			= JsonTalker::Action;
+using ActionState 		= JsonTalker::ActionState;
 
 class JsonTalker;
 
 
+// The bits of a table with at least the given entries
+constexpr uint8_t _actions_hash_bits(uint16_t entries, uint8_t bits = 0) {
+	return (1U << bits) >= entries ? bits : _actions_hash_bits(entries, bits + 1);
+}
+
+
+/**
+ * @class ActionsHash
+ * @brief A perfect hash of the Actions names, giving the index of a named Action with a single `strcmp`
+ * @tparam N The number of Actions, as in `sizeof(calls)/sizeof(Action)`
+ *
+ * The Actions names 32 bits hashes (djb2) are first split in buckets of about four names,
+ * then each bucket gets a seed, searched once at construction from the fullest bucket to the emptiest,
+ * that scrambles its names into free slots of a table with at least twice the Actions (hash and displace).
+ * If some bucket has no such seed, like for two names with the same hash, it falls back to the linear search.
+ *
+ * Typical usage, declared after the `calls` array so that it is built after it:
+ * `ActionsHash<sizeof(calls)/sizeof(Action)> _calls_hash{calls};`
+ * `uint8_t _actionIndex(const char* name) const override { return _calls_hash.index(name, calls); }`
+ *
+ * @note The tables are built at run time and take between 2 and 4 bytes of RAM per Action, scarce on AVR boards,
+ *       and they work only with RAM Actions, the flash ones (`_actionsInFlash`) keep the linear search with `strcmp_P`.
+ */
+template <uint8_t N>
+class ActionsHash {
+
+	static_assert(N > 0, "ActionsHash requires at least one Action");
+
+	uint8_t _seeds[1U << _actions_hash_bits((N + 3) / 4, 1)];
+	uint8_t _slots[1U << _actions_hash_bits(2U * N)];	// Action index + 1, being 0 an empty slot
+	bool _perfect = false;
+
+	// 32 bits so that distinct names hardly ever get the same hash, which no seed could tell apart
+	static uint32_t _hash(const char* name) {
+		uint32_t hash = 5381;
+		while (*name) {
+			hash = (hash << 5) + hash + static_cast<uint8_t>(*name++);
+		}
+		return hash;
+	}
+
+	static uint8_t _bucket(uint32_t name_hash) {
+		return static_cast<uint32_t>(name_hash * 0x9E3779B1UL) >> (32 - _actions_hash_bits((N + 3) / 4, 1));
+	}
+
+	static uint16_t _slot(uint32_t name_hash, uint8_t seed) {
+		name_hash ^= seed * 0x01010101UL;
+		return static_cast<uint32_t>(name_hash * 0x85EBCA6BUL) >> (32 - _actions_hash_bits(2U * N));
+	}
+
+	// Tries to place all names of a bucket with the given seed, leaving the slots as they were if not
+	bool _place(const Action* calls, uint8_t bucket, uint8_t seed) {
+		uint8_t action_i = 0;
+		for (; action_i < N; ++action_i) {
+			uint32_t name_hash = _hash(calls[action_i].name);
+			if (_bucket(name_hash) != bucket) continue;
+			uint16_t slot = _slot(name_hash, seed);
+			if (_slots[slot]) break;	// Taken, by another bucket or by this bucket itself
+			_slots[slot] = action_i + 1;
+		}
+		if (action_i == N) return true;
+		while (action_i-- > 0) {	// Undoes the ones already placed
+			uint32_t name_hash = _hash(calls[action_i].name);
+			if (_bucket(name_hash) == bucket) _slots[_slot(name_hash, seed)] = 0;
+		}
+		return false;
+	}
+
+public:
+
+    /**
+     * @brief Searches the seed of each bucket that gives a distinct slot to each Action name
+     * @param calls The Actions array, with `N` Actions
+     */
+	explicit ActionsHash(const Action* calls) {
+		memset(_seeds, 0, sizeof(_seeds));
+		memset(_slots, 0, sizeof(_slots));
+		uint8_t bucket_sizes[sizeof(_seeds)] = {0};
+		uint8_t fullest = 0;
+		for (uint8_t action_i = 0; action_i < N; ++action_i) {
+			uint8_t bucket = _bucket(_hash(calls[action_i].name));
+			if (++bucket_sizes[bucket] > fullest) fullest = bucket_sizes[bucket];
+		}
+		// The fullest buckets are the hardest to place, so, they go first
+		for (uint8_t size = fullest; size > 0; --size) {
+			for (uint16_t bucket = 0; bucket < sizeof(_seeds); ++bucket) {
+				if (bucket_sizes[bucket] != size) continue;
+				uint8_t seed = 0;
+				while (!_place(calls, bucket, seed)) {
+					if (++seed == 0) return;	// No seed at all, stays not perfect
+				}
+				_seeds[bucket] = seed;
+			}
+		}
+		_perfect = true;
+	}
+
+
+    /**
+     * @brief Returns the index Action for a given Action name
+     * @param name The name of the Action
+     * @param calls The same Actions array given to the constructor
+     * @return The index number of the action or 255 if none was found
+     */
+	uint8_t index(const char* name, const Action* calls) const {
+		if (!name) return 255;
+		if (_perfect) {
+			uint32_t name_hash = _hash(name);
+			uint8_t action_i = _slots[_slot(name_hash, _seeds[_bucket(name_hash)])];
+			if (action_i && strcmp(calls[action_i - 1].name, name) == 0) {
+				return action_i - 1;
+			}
+			return 255;
+		}
+        for (uint8_t action_i = 0; action_i < N; action_i++) {
+            if (strcmp(calls[action_i].name, name) == 0) {
+                return action_i;
+            }
+        }
+        return 255;
+	}
+
+
+    /**
+     * @brief Tells if a perfect hash was found, otherwise `index` searches linearly
+     */
+	bool is_perfect() const { return _perfect; }
+
+};
+
+
 /**
  * @class TalkerManifesto
  * @brief An Interface to be implemented as a Manifesto to define the Talker's actions
@@ -50,6 +182,9 @@ class JsonTalker;
  * The implementation of this class requires de definition of a list of actions like so:
  *     `Action calls[1] = {{"on", "Turns led ON"}};`
  *
+ * On AVR boards the Actions may be kept in flash instead, sparing their RAM, given that the names, the
+ * descriptions and the array itself are all declared `PROGMEM` and `_actionsInFlash` returns true.
+ *
  * @note Find `TalkerManifesto` implementation in https://github.com/ruiseixasm/JsonTalkie/tree/main/src/manifestos.
  */
 class TalkerManifesto {
@@ -85,6 +220,33 @@ public:
      */
     virtual const Action* _getActionsArray() const = 0;
 
+
+	/**
+     * @brief Tells if the actions array and its strings are stored in flash (PROGMEM)
+	 * 
+	 * The typical flash array, with each string declared like `const char on_name[] PROGMEM = "on";`, is:
+	 * `const Action calls[1] PROGMEM = {{on_name, on_desc}};`
+	 * 
+     * @note The flash Actions are read with `_getAction`, and they can't be used with an `ActionsHash`.
+     */
+    virtual bool _actionsInFlash() const { return false; }
+
+
+	/**
+     * @brief Get a copy of an Action, read from RAM or from flash
+     * @param index The index of the Action, up to `_actionsCount()`
+     * @return The Action, with its strings in flash if `_actionsInFlash()`
+     */
+    Action _getAction(uint8_t index) const {
+		Action action;
+		if (_actionsInFlash()) {
+			memcpy_P(&action, _getActionsArray() + index, sizeof(Action));
+		} else {
+			action = _getActionsArray()[index];
+		}
+		return action;
+	}
+
 	
 	/**
      * @brief Method intended to be called by the Repeater class by its public loop method
@@ -101,10 +263,14 @@ public:
      * @brief Returns the index Action for a given Action name
      * @param name The name of the Action
      * @return The index number of the action or 255 if none was found
+	 * 
+     * @note It compares the name with each Action in turn, so, Manifestos with many Actions
+	 *       may override it with an `ActionsHash`.
      */
     virtual uint8_t _actionIndex(const char* name) const {
+		bool in_flash = _actionsInFlash();
         for (uint8_t i = 0; i < _actionsCount(); i++) {
-            if (strcmp(_getActionsArray()[i].name, name) == 0) {
+            if (in_flash ? strcmp_P(name, _getAction(i).name) == 0 : strcmp(_getActionsArray()[i].name, name) == 0) {
                 return i;
             }
         }
@@ -138,6 +304,47 @@ public:
         return false;
 	}
 
+
+    /**
+     * @brief Starts a given Action by it's index number, allowing it to be completed later
+     * @param index The index of the Action being started
+     * @param talker Allows the access by the Manifesto to its owner Talker class
+     * @param json_message The json message made available for manipulation
+     * @param talker_match The type of matching concerning the Talker call
+     * @return Returns the Action state, roger or negative if done, pending if not
+	 * 
+	 * By default it calls `_actionByIndex`, so, only the Manifestos with slow Actions, like
+	 * sensor reads or servo moves, need to override it and return `TALKIE_AS_PENDING`.
+	 * 
+     * @note Any needed argument shall be kept by the Manifesto, given that the pending reply
+	 *       is a new message with just the original call identity, caller and action. Only one
+	 *       Action is pending per Talker, so, while `talker.get_pending()`, this method isn't
+	 *       called and any call is replied as negative.
+     */
+    virtual ActionState _startAction(uint8_t index, JsonTalker& talker, JsonMessage& json_message, TalkerMatch talker_match) {
+        if (_actionByIndex(index, talker, json_message, talker_match)) {
+			return ActionState::TALKIE_AS_ROGER;
+		}
+		return ActionState::TALKIE_AS_NEGATIVE;
+	}
+
+
+    /**
+     * @brief Polls a pending Action, the continuation of `_startAction`, from the Talker loop
+     * @param index The index of the pending Action
+     * @param talker Allows the access by the Manifesto to its owner Talker class
+     * @param json_message The reply message where to set any resulting nth values
+     * @return Returns the Action state, being replied once it's no longer pending
+	 * 
+     * @note This method shall return fast, doing at most one step of the pending Action.
+     */
+    virtual ActionState _pollAction(uint8_t index, JsonTalker& talker, JsonMessage& json_message) {
+        (void)index;		// Silence unused parameter warning
+        (void)talker;		// Silence unused parameter warning
+        (void)json_message;	// Silence unused parameter warning
+        return ActionState::TALKIE_AS_NEGATIVE;
+	}
+
 	
     /**
      * @brief The method that processes the received echoes of the messages sent
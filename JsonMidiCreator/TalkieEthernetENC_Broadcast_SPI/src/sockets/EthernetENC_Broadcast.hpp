@@ -26,27 +26,118 @@ https://github.com/ruiseixasm/JsonTalkie
 
 #define ENABLE_DIRECT_ADDRESSING
 
+#define TALKIE_MAX_PEERS 8					///< Remote talkers remembered for direct replies
+#define TALKIE_PEER_LIFETIME_MS 30000UL		///< Peers not heard for longer than this are forgotten
+#define TALKIE_PEER_NAME 8					///< Leading name characters kept per peer, compared along its hash
+
 
 class EthernetENC_Broadcast : public BroadcastSocket {
 protected:
 
     uint16_t _port = 5005;
     EthernetENC_BroadcastUDP* _udp = nullptr;
-	// Source Talker info
-	char _from_name[TALKIE_NAME_LEN] = {'\0'};
-    IPAddress _from_ip = IPAddress(255, 255, 255, 255);   // By default it's used the broadcast IP
 
+	/**
+	 * @brief Remote talker address learned from its received messages
+	 * @note A `name_hash` of 0 marks a free slot
+	 */
+	struct Peer {
+		uint16_t name_hash;
+		char name[TALKIE_PEER_NAME];	// The leading characters, not null terminated if longer
+		uint16_t last_seen;		// Truncated millis() of the last valid message
+		IPAddress ip;
+	};
+
+	Peer _peers[TALKIE_MAX_PEERS];
+
+	// Either the broadcast address or the joined multicast group
+	IPAddress _broadcast_ip = IPAddress(255, 255, 255, 255);
     // ===== [SELF IP] cache our own IP =====
     IPAddress _local_ip;
 
 	
     // Constructor
-    EthernetENC_Broadcast() : BroadcastSocket() {}
+    EthernetENC_Broadcast() : BroadcastSocket() {
+		for (uint8_t peer_i = 0; peer_i < TALKIE_MAX_PEERS; ++peer_i) {
+			_peers[peer_i].name_hash = 0;
+		}
+	}
+
+
+    /**
+     * @brief Records, or refreshes, the address of a remote talker
+     * @param name The talker name
+     * @param ip The remote address of the talker
+     * 
+     * @note When the table is full, the least recently heard peer is replaced
+     */
+	void _learnPeer(const char* name, const IPAddress& ip) {
+		if (!name) return;
+		uint16_t name_hash = JsonMessage::_name_hash(name);
+		uint16_t now = (uint16_t)millis();
+		uint8_t peer_i = 0;
+		uint16_t oldest_age = 0;
+		for (uint8_t slot_i = 0; slot_i < TALKIE_MAX_PEERS; ++slot_i) {
+			if (_peers[slot_i].name_hash == name_hash && strncmp(_peers[slot_i].name, name, TALKIE_PEER_NAME) == 0) {
+				peer_i = slot_i;
+				break;
+			}
+			// Free slots count as the oldest possible ones
+			uint16_t age = _peers[slot_i].name_hash ? (uint16_t)(now - _peers[slot_i].last_seen) : 0xFFFF;
+			if (age > oldest_age) {
+				oldest_age = age;
+				peer_i = slot_i;
+			}
+		}
+		_peers[peer_i].name_hash = name_hash;
+		for (uint8_t char_i = 0; char_i < TALKIE_PEER_NAME; ++char_i) {
+			_peers[peer_i].name[char_i] = *name ? *name++ : '\0';	// Zero padded, not terminated if longer
+		}
+		_peers[peer_i].last_seen = now;
+		_peers[peer_i].ip = ip;
+	}
+
+
+    /**
+     * @brief Gets the peer of a remote talker, if still fresh
+     * @param name The talker name
+     * @return The peer or nullptr if unknown
+     * 
+     * @note Besides the hash, the leading name characters have to match too, so, a hash
+     *       collision falls back to the broadcast instead of reaching the wrong talker
+     */
+	const Peer* _findPeer(const char* name) const {
+		if (name) {
+			uint16_t name_hash = JsonMessage::_name_hash(name);
+			for (uint8_t peer_i = 0; peer_i < TALKIE_MAX_PEERS; ++peer_i) {
+				if (_peers[peer_i].name_hash == name_hash && strncmp(_peers[peer_i].name, name, TALKIE_PEER_NAME) == 0) {
+					return &_peers[peer_i];
+				}
+			}
+		}
+		return nullptr;
+	}
+
+
+    /**
+     * @brief Frees the peers that weren't heard for more than `TALKIE_PEER_LIFETIME_MS`
+     * 
+     * @note Called on every receive, so the 16 bits ages never wrap around
+     */
+	void _agePeers() {
+		uint16_t now = (uint16_t)millis();
+		for (uint8_t peer_i = 0; peer_i < TALKIE_MAX_PEERS; ++peer_i) {
+			if (_peers[peer_i].name_hash && (uint16_t)(now - _peers[peer_i].last_seen) > TALKIE_PEER_LIFETIME_MS) {
+				_peers[peer_i].name_hash = 0;
+			}
+		}
+	}
 
 
     void _receive() override {
 
         if (_udp) {
+			_agePeers();
 			// Receive packets
 			int packetSize = _udp->parsePacket();
 			if (packetSize > 0) {
@@ -87,8 +178,7 @@ protected:
 					if (new_message._validate_json()) {
 				
 						if (new_message._process_checksum()) {
-							strcpy(_from_name, new_message.get_from_name());
-							_from_ip = _udp->remoteIP();
+							_learnPeer(new_message.get_from_name(), _udp->remoteIP());
 						}
 		
 						#ifdef BROADCAST_ETHERNETENC_DEBUG
@@ -114,11 +204,13 @@ protected:
 		
         if (_udp) {
 			
-            IPAddress broadcastIP(255, 255, 255, 255);
+            const IPAddress& broadcastIP = _broadcast_ip;
 
             #ifdef ENABLE_DIRECT_ADDRESSING
 
-			bool as_reply = json_message.is_to_name(_from_name);
+			// Direct replies only to known talkers, everything else is broadcasted
+			const Peer* peer = _findPeer(json_message.get_to_name());
+			bool as_reply = peer != nullptr;
 
 			#ifdef BROADCAST_ETHERNETENC_DEBUG_NEW
 			Serial.print(F("\t\t\t\t\tsend orgn: "));
@@ -137,7 +229,7 @@ protected:
 			Serial.println(_sending_length);
 			#endif
 
-            if (!_udp->beginPacket(as_reply ? _from_ip : broadcastIP, _port)) {
+            if (!(as_reply ? _udp->beginPacket(peer->ip, _port) : _udp->beginPacket(broadcastIP, _port))) {
                 #ifdef BROADCAST_ETHERNETENC_DEBUG
                 Serial.println(F("\tFailed to begin packet"));
                 #endif
@@ -145,15 +237,17 @@ protected:
             } else {
 				
 				#ifdef BROADCAST_ETHERNETENC_DEBUG
-				if (as_reply && _from_ip != broadcastIP) {
+				if (as_reply) {
 
 					Serial.print(F("\tsend1: --> Directly sent to the  "));
-					Serial.print(_from_ip);
+					Serial.print(peer->ip);
 					Serial.print(F(" address --> "));
 					
 				} else {
 					
-					Serial.print(F("\tsend1: --> Broadcast sent to the 255.255.255.255 address --> "));
+					Serial.print(F("\tsend1: --> Broadcast sent to the "));
+					Serial.print(broadcastIP);
+					Serial.print(F(" address --> "));
 					
 				}
 				#endif
@@ -167,7 +261,9 @@ protected:
             } else {
 									
 				#ifdef BROADCAST_ETHERNETENC_DEBUG
-				Serial.print(F("\tsend1: --> Broadcast sent to the 255.255.255.255 address --> "));
+				Serial.print(F("\tsend1: --> Broadcast sent to the "));
+				Serial.print(broadcastIP);
+				Serial.print(F(" address --> "));
 				#endif
 
 			}
@@ -219,6 +315,22 @@ public:
         _udp = udp;
     }
 
+
+    /**
+     * @brief Replaces the 255.255.255.255 broadcast by an IP multicast group
+     * @param group The multicast group address, like 239.255.0.1
+     * @return true if the group was joined (IGMP)
+     * 
+     * @note Has to be called after `set_udp` and `set_port`, with the same group
+     *       being used by all talkers, devices and hosts alike
+     */
+	bool set_multicast(IPAddress group) {
+		if (!_udp || (group[0] & 0xF0) != 0xE0) return false;
+		if (!_udp->beginMulticast(group, _port)) return false;
+		_broadcast_ip = group;
+		return true;
+	}
+
 };
 
 #endif // ETHERNETENC_BROADCAST_HPP
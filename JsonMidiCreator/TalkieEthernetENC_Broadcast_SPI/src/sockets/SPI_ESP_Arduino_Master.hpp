@@ -28,15 +28,28 @@ https://github.com/ruiseixasm/JsonTalkie
 #define ENABLE_DIRECT_ADDRESSING
 
 
-#define send_delay_us 10
-#define receive_delay_us 10
-#define TALKIE_MAX_NAMES 8
+#define TALKIE_SPI_DELAY_US 10				///< Initial delay between bytes, the one safe for AVR Slaves
+#define TALKIE_SPI_MIN_DELAY_US 1			///< Shortest delay between bytes ever tried
+#define TALKIE_SPI_MAX_DELAY_US 40			///< Longest delay between bytes after backing off
+#define TALKIE_SPI_TUNE_TRANSFERS 64		///< Clean transfers before probing a 1us shorter block delay
+#define TALKIE_SPI_PROBE_LENGTH 32			///< Bytes sent by each calibration probe
+#define TALKIE_SPI_MARGIN_US 2				///< Added to the calibrated delay, the exchange ISR path being the longest
+#define TALKIE_SPI_BLOCK_MARGIN_US 1		///< Added to the calibrated block delay, its bytes aren't echoed
+#define TALKIE_SPI_VERSION 4				///< Highest protocol version, 2 adds the CRC-16 block frames, 3 their exchange and 4 the broadcast
+#define TALKIE_SPI_MAX_BACKOFF 8			///< Most polling rounds skipped by an idle Slave
+#define TALKIE_SPI_MAX_PROFILES 8			///< Slaves with their own timing, the extra ones share the last
+#define TALKIE_MAX_ROUTES 16				///< Talker names routable to a SS pin (power of 2)
+#define TALKIE_ROUTE_LIFETIME_MS 30000UL	///< Routes not refreshed for longer than this are dropped
+#define TALKIE_ROUTE_NAME 4					///< Leading name characters kept per route, compared along its hash
 
 
 class SPI_ESP_Arduino_Master : public BroadcastSocket {
 public:
 
     enum StatusByte : uint8_t {
+		TALKIE_SB_BROADCAST_STATUS	= 0xED,	// Asks how the last broadcast block frame went (version 4)
+		TALKIE_SB_BROADCAST_BLOCK	= 0xEE,	// Block frame written to all Slaves at once, MISO released (version 4)
+		TALKIE_SB_EXCHANGE_BLOCK	= 0xEF,	// Sends and receives block frames at once, full duplex (version 3)
         TALKIE_SB_ACK		= 0xF0, // Acknowledge
         TALKIE_SB_NACK		= 0xF1, // Not acknowledged
         TALKIE_SB_READY   	= 0xF2, // Slave is ready
@@ -50,6 +63,8 @@ public:
 		TALKIE_SB_DONE		= 0xFA,	// Marks the action as DONE
         TALKIE_SB_ERROR   	= 0xFB, // Error frame
         TALKIE_SB_FULL    	= 0xFC, // Signals the buffer as full
+		TALKIE_SB_RECEIVE_BLOCK	= 0xFD,	// Asks to receive a length, raw bytes and CRC-16 frame (version 2)
+		TALKIE_SB_SEND_BLOCK	= 0xFE,	// Asks to send a length, raw bytes and CRC-16 frame (version 2)
         
         TALKIE_SB_VOID    	= 0xFF  // MISO floating (0xFF) → no slave responding
     };
@@ -65,17 +80,86 @@ protected:
 	bool _initiated = false;
     int* _ss_pins;
     uint8_t _ss_pins_count = 0;
-	char _names[TALKIE_MAX_NAMES][TALKIE_NAME_LEN];
 	uint8_t _actual_ss_pin_i = 0;
 
+	/**
+	 * @brief Talker name to SS pin route, learned from the received `f` fields
+	 * @note A `name_hash` of 0 marks a never used slot, while a `ss_pin_i` of 255
+	 *       marks a dropped one that still keeps the probing chain intact
+	 */
+	struct Route {
+		uint16_t name_hash;
+		char name[TALKIE_ROUTE_NAME];	// The leading characters, not null terminated if longer
+		uint16_t last_seen;		// Truncated millis() of the last message from the talker
+		uint8_t ss_pin_i;
+	};
+
+	Route _routes[TALKIE_MAX_ROUTES];
+
+	/**
+	 * @brief Per Slave timing, given that an ESP32 Slave answers much faster than an AVR one
+	 * @note The Status Bytes get 2us more than the data bytes, like the original 12us vs 10us
+	 */
+	struct Timing {
+		uint8_t byte_delay_us;		// Delay between the echoed bytes and before the Status Bytes
+		uint8_t safe_delay_us;		// The calibrated `byte_delay_us`, never gone below
+		uint8_t block_delay_us;		// Delay between the block frame bytes written to the Slave (version 2)
+		uint8_t clean_transfers;	// Transfers without errors since the last adjustment
+		bool probe_block;			// A 1us shorter block delay to be probed before the next transaction
+		uint8_t version;			// Protocol version agreed by `acknowledgeSPI`
+		uint16_t errors;			// Transfer errors, for the statistics
+	};
+
+	Timing _timings[TALKIE_SPI_MAX_PROFILES];
+
+	/**
+	 * @brief Per Slave polling state and statistics
+	 * @note Slaves that keep having nothing to send are polled exponentially less often,
+	 *       up to once every `TALKIE_SPI_MAX_BACKOFF` + 1 rounds
+	 */
+	struct Polling {
+		uint16_t polls;		// Times asked for a message
+		uint16_t replies;	// Messages received
+		uint8_t backoff;	// Rounds to skip after the next empty poll
+		uint8_t skip;		// Rounds still to be skipped
+	};
+
+	Polling _pollings[TALKIE_SPI_MAX_PROFILES];
+	uint8_t _next_ss_pin_i = 0;		// Round-robin start, so that no Slave is always polled last
+
+	// Slave frame brought by a version 3 exchange, delivered on the next `_receive`
+	char _exchanged_buffer[TALKIE_BUFFER_SIZE];
+	uint8_t _exchanged_length = 0;
+	int _exchanged_ss_pin = -1;
+
+	// Optional open-drain lines the Slaves pull LOW while they have something to send
+	int* _attention_pins = nullptr;
+	uint8_t _attention_pins_count = 0;	// Either 1 (shared) or one per SS pin
+
+	bool _broadcast = false;	// Version 4 broadcast, only with `set_broadcast(true)`
+
 
     // Constructor
     SPI_ESP_Arduino_Master(int* ss_pins, uint8_t ss_pins_count) : BroadcastSocket() {
             
         	_ss_pins = ss_pins;
         	_ss_pins_count = ss_pins_count;
-			for (uint8_t ss_pin_i = 0; ss_pin_i < _ss_pins_count && ss_pin_i < TALKIE_MAX_NAMES; ++ss_pin_i) {
-				_names[ss_pin_i][0] = '\0';
+			for (uint8_t route_i = 0; route_i < TALKIE_MAX_ROUTES; ++route_i) {
+				_routes[route_i].name_hash = 0;
+				_routes[route_i].ss_pin_i = 255;
+			}
+			for (uint8_t profile_i = 0; profile_i < TALKIE_SPI_MAX_PROFILES; ++profile_i) {
+				_timings[profile_i].byte_delay_us = TALKIE_SPI_DELAY_US;
+				_timings[profile_i].safe_delay_us = TALKIE_SPI_DELAY_US;
+				_timings[profile_i].block_delay_us = TALKIE_SPI_DELAY_US;
+				_timings[profile_i].clean_transfers = 0;
+				_timings[profile_i].probe_block = false;
+				_timings[profile_i].version = 1;
+				_timings[profile_i].errors = 0;
+				_pollings[profile_i].polls = 0;
+				_pollings[profile_i].replies = 0;
+				_pollings[profile_i].backoff = 0;
+				_pollings[profile_i].skip = 0;
 			}
             _max_delay_ms = 0;  // SPI is sequencial, no need to control out of order packages
         }
@@ -83,8 +167,642 @@ protected:
     
     // Specific methods associated to Arduino SPI as Master
 
+
+    /**
+     * @brief Routes a talker name to the SS pin it was heard from
+     * @param name The talker name
+     * @param ss_pin_i The index of the SS pin
+     * 
+     * @note Uses linear probing starting at the hash slot, when the table is full
+     *       the least recently heard route is the one replaced
+     */
+	void _learnRoute(const char* name, uint8_t ss_pin_i) {
+		if (!name) return;
+		uint16_t name_hash = JsonMessage::_name_hash(name);
+		uint16_t now = (uint16_t)millis();
+		uint8_t free_i = TALKIE_MAX_ROUTES;
+		uint8_t oldest_i = 0;
+		uint16_t oldest_age = 0;
+		for (uint8_t probe_i = 0; probe_i < TALKIE_MAX_ROUTES; ++probe_i) {
+			uint8_t route_i = (name_hash + probe_i) & (TALKIE_MAX_ROUTES - 1);
+			Route& route = _routes[route_i];
+			if (route.name_hash == name_hash && strncmp(route.name, name, TALKIE_ROUTE_NAME) == 0) {
+				route.ss_pin_i = ss_pin_i;	// Also revives a dropped route
+				route.last_seen = now;
+				return;
+			}
+			if (route.ss_pin_i == 255) {
+				if (free_i == TALKIE_MAX_ROUTES) free_i = route_i;
+				if (!route.name_hash) break;	// End of the chain, name not routed yet
+			} else if ((uint16_t)(now - route.last_seen) >= oldest_age) {
+				oldest_age = (uint16_t)(now - route.last_seen);
+				oldest_i = route_i;
+			}
+		}
+		if (free_i == TALKIE_MAX_ROUTES) free_i = oldest_i;
+		_routes[free_i].name_hash = name_hash;
+		for (uint8_t char_i = 0; char_i < TALKIE_ROUTE_NAME; ++char_i) {
+			_routes[free_i].name[char_i] = *name ? *name++ : '\0';	// Zero padded, not terminated if longer
+		}
+		_routes[free_i].last_seen = now;
+		_routes[free_i].ss_pin_i = ss_pin_i;
+	}
+
+
+    /**
+     * @brief Gets the SS pin index of a talker name
+     * @param name The talker name
+     * @return The SS pin index or 255 if the name isn't routed
+     * 
+     * @note Besides the hash, the leading name characters have to match too, so, a hash
+     *       collision falls back to the broadcast instead of reaching the wrong Slave
+     */
+	uint8_t _findRoute(const char* name) const {
+		if (name) {
+			uint16_t name_hash = JsonMessage::_name_hash(name);
+			for (uint8_t probe_i = 0; probe_i < TALKIE_MAX_ROUTES; ++probe_i) {
+				const Route& route = _routes[(name_hash + probe_i) & (TALKIE_MAX_ROUTES - 1)];
+				if (route.name_hash == name_hash && strncmp(route.name, name, TALKIE_ROUTE_NAME) == 0) return route.ss_pin_i;
+				if (!route.name_hash) break;
+			}
+		}
+		return 255;
+	}
+
+
+    /**
+     * @brief Drops the routes that weren't refreshed for more than `TALKIE_ROUTE_LIFETIME_MS`
+     * 
+     * @note Called on every polling round, so the 16 bits ages never wrap around
+     */
+	void _ageRoutes() {
+		uint16_t now = (uint16_t)millis();
+		for (uint8_t route_i = 0; route_i < TALKIE_MAX_ROUTES; ++route_i) {
+			if (_routes[route_i].ss_pin_i != 255 && (uint16_t)(now - _routes[route_i].last_seen) > TALKIE_ROUTE_LIFETIME_MS) {
+				_routes[route_i].ss_pin_i = 255;
+			}
+		}
+	}
+
+
+    /**
+     * @brief Gets the timing profile of a Slave
+     * @param ss_pin_i The index of the SS pin
+     * @return The timing profile, shared by the Slaves beyond `TALKIE_SPI_MAX_PROFILES`
+     */
+	Timing& _timingOf(uint8_t ss_pin_i) {
+		return _timings[ss_pin_i < TALKIE_SPI_MAX_PROFILES ? ss_pin_i : TALKIE_SPI_MAX_PROFILES - 1];
+	}
+
+
+    /**
+     * @brief Gets the polling state of a Slave
+     * @param ss_pin_i The index of the SS pin
+     * @return The polling state, shared by the Slaves beyond `TALKIE_SPI_MAX_PROFILES`
+     */
+	Polling& _pollingOf(uint8_t ss_pin_i) {
+		return _pollings[ss_pin_i < TALKIE_SPI_MAX_PROFILES ? ss_pin_i : TALKIE_SPI_MAX_PROFILES - 1];
+	}
+
+
+    /**
+     * @brief Makes a Slave be polled on every round again, like after being sent a message
+     * @param ss_pin_i The index of the SS pin
+     */
+	void _wakePolling(uint8_t ss_pin_i) {
+		Polling& polling = _pollingOf(ss_pin_i);
+		polling.backoff = 0;
+		polling.skip = 0;
+	}
+
+
+    /**
+     * @brief Backs off a delay of a Slave by 1.5 times after a transfer error
+     * @param timing The timing profile of the Slave
+     * @param block If the error was in the block frame bytes, and so, it's the block delay that backs off
+     * @return true if the delay got longer, so, the failed try is taken again without counting as one
+	 *         of the 3, given that the delay only grows up to `TALKIE_SPI_MAX_DELAY_US`
+     */
+	bool _timingError(Timing& timing, bool block = false) {
+		uint8_t& delay_us = block ? timing.block_delay_us : timing.byte_delay_us;
+		uint8_t backed_off_us = delay_us + (delay_us >> 1) + 1;
+		bool backed_off = delay_us < TALKIE_SPI_MAX_DELAY_US;
+		delay_us = backed_off_us < TALKIE_SPI_MAX_DELAY_US ? backed_off_us : TALKIE_SPI_MAX_DELAY_US;
+		timing.clean_transfers = 0;
+		timing.errors++;
+		return backed_off;
+	}
+
+
+    /**
+     * @brief Counts a clean transfer, and after `TALKIE_SPI_TUNE_TRANSFERS` of them, brings a backed off
+	 *        byte delay 1us back towards the calibrated one or asks for a 1us shorter block delay to be probed
+     * @param timing The timing profile of the Slave
+     * 
+     * @note The byte delay, the only one of version 1, is never tuned below the calibrated one
+     */
+	void _timingClean(Timing& timing) {
+		if (++timing.clean_transfers >= TALKIE_SPI_TUNE_TRANSFERS) {
+			timing.clean_transfers = 0;
+			if (timing.byte_delay_us > timing.safe_delay_us) {
+				timing.byte_delay_us--;
+			} else if (timing.version >= 2 && timing.block_delay_us > TALKIE_SPI_MIN_DELAY_US + TALKIE_SPI_BLOCK_MARGIN_US) {
+				timing.probe_block = true;	// Not here, the SS pin may still be LOW
+			}
+		}
+	}
+
+
+    /**
+     * @brief Shortens the block delay of a Slave by 1us if two calibration probes pass with the margin taken out
+     * @param ss_pin The SS pin of the Slave
+     * @param timing The timing profile of the Slave
+     * 
+     * @note A shorter delay is only ever tried with the probes, that deliver nothing, so, no message is lost
+	 *       looking for it, while a failed probe just keeps the delay as it is
+     */
+	void _probeTiming(int ss_pin, Timing& timing) {
+		timing.probe_block = false;
+		uint8_t block_delay_us = timing.block_delay_us - 1 - TALKIE_SPI_BLOCK_MARGIN_US;
+		if (_probeBlockSPI(ss_pin, timing, block_delay_us) && _probeBlockSPI(ss_pin, timing, block_delay_us)) {
+			timing.block_delay_us--;
+		}
+	}
+
+
+    /**
+     * @brief Tells if a Slave answered the first byte of a transaction, meaning, it isn't VOID
+     * @param timing The timing profile of the Slave
+     * @param c The byte received with the first one
+     * @return true if the transaction shall go on
+     * 
+     * @note A version 4 Slave only drives MISO after the first byte, so, its first reply says nothing
+     */
+	static bool _answered(const Timing& timing, uint8_t c) {
+		return c != TALKIE_SB_VOID || timing.version >= 4;
+	}
+
+
+    /**
+     * @brief Echoes a probe to the Slave with a given delay and aborts it with an ERROR
+     * @param ss_pin The SS pin of the Slave
+     * @param byte_delay_us The delay between bytes being tried
+     * @return true if all probe chars were echoed back
+     * 
+     * @note The aborted probe is discarded by the Slave, so, nothing is delivered to its talkers
+     */
+	bool _probeSPI(int ss_pin, uint8_t byte_delay_us) {
+		bool clean = false;
+
+		digitalWrite(ss_pin, LOW);
+		delayMicroseconds(5);
+
+		uint8_t c = _spi_instance->transfer(TALKIE_SB_RECEIVE);
+		if (c != TALKIE_SB_VOID) {
+
+			delayMicroseconds(byte_delay_us + 2);
+			c = _spi_instance->transfer('0');
+			if (c == TALKIE_SB_READY) {
+				clean = true;
+				for (uint8_t i = 1; i < TALKIE_SPI_PROBE_LENGTH; i++) {
+					delayMicroseconds(byte_delay_us);
+					c = _spi_instance->transfer('0' + i);	// Receives the echoed '0' + i - 1
+					if (i > 1 && c != '0' + i - 2) {
+						clean = false;
+						break;
+					}
+				}
+			}
+			delayMicroseconds(TALKIE_SPI_DELAY_US + 2);
+			_spi_instance->transfer(TALKIE_SB_ERROR);	// Makes the Slave drop the probe
+		}
+
+		delayMicroseconds(5);
+		digitalWrite(ss_pin, HIGH);
+		return clean;
+	}
+
+
+    /**
+     * @brief Sends a version 2 block frame probe with a wrong CRC, on the same ISR path as the
+	 *        messages, so that the Slave answers it with an ERROR only if it took all its bytes
+     * @param ss_pin The SS pin of the Slave
+     * @param timing The timing profile of the Slave
+     * @param block_delay_us The delay between the frame bytes being tried, the Status Bytes keep the byte delay
+     * @return true if the ERROR came right after the frame
+     * 
+     * @note Given the wrong CRC, nothing is delivered to the Slave talkers, and a Slave still holding
+	 *       a received message answers BUSY instead, making the probe fail without harm
+     */
+	bool _probeBlockSPI(int ss_pin, const Timing& timing, uint8_t block_delay_us) {
+		bool clean = false;
+
+		digitalWrite(ss_pin, LOW);
+		delayMicroseconds(5);
+
+		uint8_t c = _spi_instance->transfer(TALKIE_SB_RECEIVE_BLOCK);
+		if (_answered(timing, c)) {
+
+			delayMicroseconds(timing.byte_delay_us + 2);
+			c = _spi_instance->transfer(TALKIE_SPI_PROBE_LENGTH);
+			if (c == TALKIE_SB_READY) {
+				uint16_t crc = 0xFFFF;
+				for (uint8_t i = 0; i < TALKIE_SPI_PROBE_LENGTH; i++) {
+					delayMicroseconds(block_delay_us);
+					_spi_instance->transfer('0' + i);
+					crc = _crc16(crc, '0' + i);
+				}
+				crc = ~crc;	// Makes the Slave drop the probe
+				delayMicroseconds(block_delay_us);
+				_spi_instance->transfer((uint8_t)(crc >> 8));
+				delayMicroseconds(block_delay_us);
+				_spi_instance->transfer((uint8_t)crc);
+				delayMicroseconds(timing.byte_delay_us + 2 + block_delay_us);	// Like the messages, with the ISR lag
+				clean = _spi_instance->transfer(TALKIE_SB_END) == TALKIE_SB_ERROR;
+			}
+		}
+
+		delayMicroseconds(5);
+		digitalWrite(ss_pin, HIGH);
+		return clean;
+	}
+
+
+    /**
+     * @brief Sets the shortest delay with which the Slave takes two probes in a row, plus `TALKIE_SPI_MARGIN_US`,
+	 *        and from version 2 on, the same for the block delay alone, plus `TALKIE_SPI_BLOCK_MARGIN_US`
+     * @param ss_pin The SS pin of the Slave
+     * @param timing The timing profile of the Slave, with the version already agreed
+     * 
+     * @note From version 2 on the probes take the block frames path, the one of the messages,
+	 *       and if no delay passes, the delay is set as `TALKIE_SPI_MAX_DELAY_US`
+     */
+	void _calibrateSPI(int ss_pin, Timing& timing) {
+		timing.clean_transfers = 0;
+		timing.byte_delay_us = TALKIE_SPI_MAX_DELAY_US;
+		for (uint8_t byte_delay_us = TALKIE_SPI_MIN_DELAY_US; byte_delay_us < TALKIE_SPI_MAX_DELAY_US; byte_delay_us++) {
+			timing.byte_delay_us = byte_delay_us;
+			bool clean = timing.version >= 2
+				? _probeBlockSPI(ss_pin, timing, byte_delay_us) && _probeBlockSPI(ss_pin, timing, byte_delay_us)
+				: _probeSPI(ss_pin, byte_delay_us) && _probeSPI(ss_pin, byte_delay_us);
+			timing.byte_delay_us = TALKIE_SPI_MAX_DELAY_US;
+			if (clean) {
+				uint8_t calibrated_us = byte_delay_us + TALKIE_SPI_MARGIN_US;
+				timing.byte_delay_us = calibrated_us < TALKIE_SPI_MAX_DELAY_US ? calibrated_us : TALKIE_SPI_MAX_DELAY_US;
+				break;
+			}
+		}
+		timing.safe_delay_us = timing.byte_delay_us;
+		timing.block_delay_us = timing.byte_delay_us;
+		if (timing.version >= 2) {
+			// The block bytes alone, the Status Bytes keeping the calibrated delay
+			for (uint8_t block_delay_us = TALKIE_SPI_MIN_DELAY_US; block_delay_us < timing.byte_delay_us; block_delay_us++) {
+				if (_probeBlockSPI(ss_pin, timing, block_delay_us) && _probeBlockSPI(ss_pin, timing, block_delay_us)) {
+					uint8_t calibrated_us = block_delay_us + TALKIE_SPI_BLOCK_MARGIN_US;
+					if (calibrated_us < timing.block_delay_us) timing.block_delay_us = calibrated_us;
+					break;
+				}
+			}
+		}
+
+		#ifdef BROADCAST_SPI_DEBUG
+		Serial.print(F("\tcalibrateSPI1: Delay between bytes (us): "));
+		Serial.print(timing.byte_delay_us);
+		Serial.print(F(", between block bytes (us): "));
+		Serial.println(timing.block_delay_us);
+		#endif
+	}
+
+
+
+    /**
+     * @brief Sends a version 2 block frame, being it the length, the raw bytes and their CRC-16,
+	 *        answered by a single ACK or ERROR
+     * @param ss_pin The SS pin of the Slave
+     * @param timing The timing profile of the Slave
+     * @param message_buffer The bytes to be sent, any value allowed
+     * @param length The amount of bytes, up to `TALKIE_BUFFER_SIZE`
+     * @return true if the Slave acknowledged the frame
+     */
+	bool _sendBlockSPI(int ss_pin, Timing& timing, const char* message_buffer, size_t length) {
+		bool sent = false;
+		bool retry = true;
+		
+		for (uint8_t s = 0; retry && s < 3; s++) {
+			retry = false;
+
+			digitalWrite(ss_pin, LOW);
+			delayMicroseconds(5);
+
+			uint8_t c = _spi_instance->transfer(TALKIE_SB_RECEIVE_BLOCK);
+			if (_answered(timing, c)) {
+
+				delayMicroseconds(timing.byte_delay_us + 2);	// Makes sure it's processed by the slave (critical path)
+				c = _spi_instance->transfer((uint8_t)length);
+				if (c == TALKIE_SB_READY) {
+
+					uint16_t crc = 0xFFFF;
+					for (uint8_t i = 0; i < length; i++) {
+						delayMicroseconds(timing.block_delay_us);	// Not echoed, only has to be taken in time
+						_spi_instance->transfer(message_buffer[i]);
+						crc = _crc16(crc, message_buffer[i]);
+					}
+					delayMicroseconds(timing.block_delay_us);
+					_spi_instance->transfer((uint8_t)(crc >> 8));
+					delayMicroseconds(timing.block_delay_us);
+					_spi_instance->transfer((uint8_t)crc);
+					// Makes sure the Slave checks the CRC, its ISR lagging up to a block byte behind the bus
+					delayMicroseconds(timing.byte_delay_us + 2 + timing.block_delay_us);
+					c = _spi_instance->transfer(TALKIE_SB_END);		// Returns the ACK or ERROR
+					if (c == TALKIE_SB_ACK) {
+						sent = true;
+						_timingClean(timing);
+					} else {
+						retry = true;
+						if (_timingError(timing, true)) s--;
+						#ifdef BROADCAST_SPI_DEBUG_1
+						Serial.println(F("\t\tERROR: Block frame NOT acknowledged"));
+						#endif
+					}
+				} else if (c == TALKIE_SB_BUSY) {
+					#ifdef BROADCAST_SPI_DEBUG_1
+					Serial.println(F("\t\tBUSY: Slave is busy, waiting a little."));
+					#endif
+					retry = true;
+					if (s < 2) {
+						delay(2);	// Waiting 2ms
+					}
+				} else {
+					retry = true;	// Nothing was taken yet, so, tried again with the longer delay
+					if (_timingError(timing)) s--;	// Most likely a stale byte from a Slave still processing
+					#ifdef BROADCAST_SPI_DEBUG_1
+					Serial.print(F("\t\tERROR: Device NOT ready for the block: "));
+					Serial.println(c, HEX);
+					#endif
+				}
+			}
+
+			delayMicroseconds(5);
+			digitalWrite(ss_pin, HIGH);
+		}
+		return sent;
+	}
+
+
+    /**
+     * @brief Receives a version 2 block frame, confirming it with END or rejecting it with ERROR
+     * @param ss_pin The SS pin of the Slave
+     * @param timing The timing profile of the Slave
+     * @param message_buffer The buffer for the received bytes
+     * @param buffer_size The size of the buffer
+     * @return The length of the received frame, 0 if none
+     */
+	size_t _receiveBlockSPI(int ss_pin, Timing& timing, char* message_buffer, size_t buffer_size) {
+		size_t size = 0;
+		bool retry = true;
+
+		for (uint8_t r = 0; retry && r < 3; r++) {
+			retry = false;
+
+			digitalWrite(ss_pin, LOW);
+			delayMicroseconds(5);
+
+			uint8_t c = _spi_instance->transfer(TALKIE_SB_SEND_BLOCK);
+			if (_answered(timing, c)) {
+
+				delayMicroseconds(timing.byte_delay_us + 2);	// Makes sure it's processed by the slave (critical path)
+				c = _spi_instance->transfer('\0');	// Gets the length
+				if (c > 0 && c <= buffer_size) {
+
+					uint8_t length = c;
+					uint16_t crc = 0xFFFF;
+					for (uint8_t i = 0; i < length + 2; i++) {	// Payload and CRC
+						delayMicroseconds(timing.byte_delay_us);
+						c = _spi_instance->transfer('\0');
+						if (i < length) message_buffer[i] = c;
+						crc = _crc16(crc, c);
+					}
+					delayMicroseconds(timing.byte_delay_us + 2);    // Makes sure the Status Byte is sent
+					if (!crc) {
+						_spi_instance->transfer(TALKIE_SB_END);		// Confirms it, the Slave deletes it
+						size = length;
+						_timingClean(timing);
+					} else {
+						_spi_instance->transfer(TALKIE_SB_ERROR);	// The Slave keeps it for a retry
+						retry = true;
+						if (_timingError(timing)) r--;
+						#ifdef BROADCAST_SPI_DEBUG_1
+						Serial.println(F("\t\tERROR: Block frame with a wrong CRC"));
+						#endif
+					}
+				} else if (c != TALKIE_SB_NONE) {
+					retry = true;	// Nothing was taken yet, so, tried again with the longer delay
+					if (_timingError(timing)) r--;	// Most likely a stale byte from a Slave still processing
+					#ifdef BROADCAST_SPI_DEBUG_1
+					Serial.print(F("\t\tERROR: Device NOT ready with the block: "));
+					Serial.println(c, HEX);
+					#endif
+				}
+			}
+
+			delayMicroseconds(5);
+			digitalWrite(ss_pin, HIGH);
+		}
+		return size;
+	}
+
+
+
+    /**
+     * @brief Sends a version 3 block frame while receiving the one the Slave has pending, both shifted
+	 *        in the same transaction, with the Slave frame going one byte behind after its length
+     * @param ss_pin The SS pin of the Slave
+     * @param timing The timing profile of the Slave
+     * @param message_buffer The bytes to be sent, any value allowed
+     * @param message_length The amount of bytes, up to `TALKIE_BUFFER_SIZE`
+     * @return true if the Slave acknowledged the frame
+     * 
+     * @note The received frame is kept in `_exchanged_buffer` and only taken (END) if that one is free,
+	 *       otherwise the Slave keeps it for a later poll
+     */
+	bool _exchangeBlockSPI(int ss_pin, Timing& timing, const char* message_buffer, size_t message_length) {
+		const uint8_t length = (uint8_t)message_length;	// Up to `TALKIE_BUFFER_SIZE`, all the slots math in 8 bits
+		bool sent = false;
+		bool retry = true;
+
+		uint16_t sending_crc = 0xFFFF;
+		for (uint8_t i = 0; i < length; i++) {
+			sending_crc = _crc16(sending_crc, message_buffer[i]);
+		}
+		
+		for (uint8_t s = 0; retry && s < 3; s++) {
+			retry = false;
+			bool take = !_exchanged_length;
+
+			digitalWrite(ss_pin, LOW);
+			delayMicroseconds(5);
+
+			uint8_t c = _spi_instance->transfer(TALKIE_SB_EXCHANGE_BLOCK);
+			if (_answered(timing, c)) {
+
+				delayMicroseconds(timing.byte_delay_us + 2);	// Makes sure it's processed by the slave (critical path)
+				c = _spi_instance->transfer(length);
+				if (c == TALKIE_SB_READY) {
+
+					delayMicroseconds(timing.byte_delay_us + 2);	// The Slave answers the length with its own
+					uint8_t received_length = 0;
+					uint16_t received_crc = 0xFFFF;
+					uint8_t slots = 1;
+					for (uint8_t slot_i = 0; slot_i < slots; slot_i++) {
+						uint8_t out = 0;
+						if (slot_i < length) {
+							out = message_buffer[slot_i];
+						} else if (slot_i == length) {
+							out = (uint8_t)(sending_crc >> 8);
+						} else if (slot_i == length + 1) {
+							out = (uint8_t)sending_crc;
+						}
+						c = _spi_instance->transfer(out);
+						if (slot_i == 0) {
+							if (c > TALKIE_BUFFER_SIZE) break;	// Not a length, the frame is lost
+							received_length = c;
+							slots = length + 2 > received_length + 3 ? length + 2 : received_length + 3;
+						} else if (slot_i < received_length + 3) {	// Payload and CRC
+							if (take && slot_i <= received_length) _exchanged_buffer[slot_i - 1] = c;
+							received_crc = _crc16(received_crc, c);
+						}
+						delayMicroseconds(timing.byte_delay_us);
+					}
+					// Makes sure the Slave checks the CRC, its ISR lagging up to a byte behind the bus
+					delayMicroseconds(timing.byte_delay_us + 2);
+
+					uint8_t verdict = TALKIE_SB_END;	// Also for nothing received
+					if (slots == 1) {
+						verdict = TALKIE_SB_ERROR;
+					} else if (received_length) {
+						if (received_crc) {
+							verdict = TALKIE_SB_ERROR;	// The Slave keeps it for a retry
+						} else if (!take) {
+							verdict = TALKIE_SB_BUSY;	// Same, but for a later poll
+						}
+					}
+					c = _spi_instance->transfer(verdict);	// Returns the ACK or ERROR of the sent frame
+					if (verdict == TALKIE_SB_END && received_length) {
+						_exchanged_length = received_length;
+						_exchanged_ss_pin = ss_pin;
+					}
+					if (c == TALKIE_SB_ACK) {
+						sent = true;
+						_timingClean(timing);
+					} else {
+						retry = true;
+						if (_timingError(timing)) s--;
+						#ifdef BROADCAST_SPI_DEBUG_1
+						Serial.println(F("\t\tERROR: Exchanged frame NOT acknowledged"));
+						#endif
+					}
+				} else if (c == TALKIE_SB_BUSY) {
+					#ifdef BROADCAST_SPI_DEBUG_1
+					Serial.println(F("\t\tBUSY: Slave is busy, waiting a little."));
+					#endif
+					retry = true;
+					if (s < 2) {
+						delay(2);	// Waiting 2ms
+					}
+				} else {
+					retry = true;	// Nothing was taken yet, so, tried again with the longer delay
+					if (_timingError(timing)) s--;	// Most likely a stale byte from a Slave still processing
+					#ifdef BROADCAST_SPI_DEBUG_1
+					Serial.print(F("\t\tERROR: Device NOT ready for the exchange: "));
+					Serial.println(c, HEX);
+					#endif
+				}
+			}
+
+			delayMicroseconds(5);
+			digitalWrite(ss_pin, HIGH);
+		}
+		return sent;
+	}
+
+
+
+    /**
+     * @brief Writes a version 4 block frame to all Slaves at once, with all SS pins LOW, followed by
+	 *        a short status poll of each Slave, the ones that missed it get it on their own
+     * @param message_buffer The bytes to be sent, any value allowed
+     * @param length The amount of bytes, up to `TALKIE_BUFFER_SIZE`
+     * @return false if the broadcast is off or not all Slaves talk version 4, so, nothing was sent
+     * 
+     * @note The Slaves keep MISO released for the frame, so, the bus time of the frame doesn't grow
+	 *       with the amount of Slaves, only the 2 bytes status poll does
+     */
+	bool _broadcastBlockSPI(const char* message_buffer, size_t length) {
+		if (!_broadcast) return false;
+		uint8_t byte_delay_us = 0;	// The slowest Slave sets the pace
+		uint8_t block_delay_us = 0;
+		for (uint8_t ss_pin_i = 0; ss_pin_i < _ss_pins_count; ss_pin_i++) {
+			Timing& timing = _timingOf(ss_pin_i);
+			if (timing.version < 4) return false;
+			if (timing.byte_delay_us > byte_delay_us) byte_delay_us = timing.byte_delay_us;
+			if (timing.block_delay_us > block_delay_us) block_delay_us = timing.block_delay_us;
+		}
+
+		for (uint8_t ss_pin_i = 0; ss_pin_i < _ss_pins_count; ss_pin_i++) {
+			digitalWrite(_ss_pins[ss_pin_i], LOW);
+		}
+		delayMicroseconds(5);
+
+		_spi_instance->transfer(TALKIE_SB_BROADCAST_BLOCK);	// Nothing is read back from here on
+		delayMicroseconds(byte_delay_us + 2);	// Makes sure it's processed by the slaves (critical path)
+		_spi_instance->transfer((uint8_t)length);
+		uint16_t crc = 0xFFFF;
+		for (uint8_t i = 0; i < length; i++) {
+			delayMicroseconds(block_delay_us);
+			_spi_instance->transfer(message_buffer[i]);
+			crc = _crc16(crc, message_buffer[i]);
+		}
+		delayMicroseconds(block_delay_us);
+		_spi_instance->transfer((uint8_t)(crc >> 8));
+		delayMicroseconds(block_delay_us);
+		_spi_instance->transfer((uint8_t)crc);
+		delayMicroseconds(byte_delay_us + 2 + block_delay_us);    // Makes sure the Slaves check the CRC, lagging ISRs included
+
+		for (uint8_t ss_pin_i = 0; ss_pin_i < _ss_pins_count; ss_pin_i++) {
+			digitalWrite(_ss_pins[ss_pin_i], HIGH);
+		}
+
+		for (uint8_t ss_pin_i = 0; ss_pin_i < _ss_pins_count; ss_pin_i++) {
+			int ss_pin = _ss_pins[ss_pin_i];
+			Timing& timing = _timingOf(ss_pin_i);
+			delayMicroseconds(5);
+			digitalWrite(ss_pin, LOW);
+			delayMicroseconds(5);
+			_spi_instance->transfer(TALKIE_SB_BROADCAST_STATUS);
+			delayMicroseconds(timing.byte_delay_us + 2);
+			uint8_t c = _spi_instance->transfer('\0');
+			delayMicroseconds(5);
+			digitalWrite(ss_pin, HIGH);
+
+			if (c == TALKIE_SB_ACK) {
+				_timingClean(timing);
+				_wakePolling(ss_pin_i);
+			} else {
+				if (c != TALKIE_SB_BUSY) _timingError(timing, true);
+				#ifdef BROADCAST_SPI_DEBUG_1
+				Serial.print(F("\t\tERROR: Broadcast frame missed by the SS pin: "));
+				Serial.println(ss_pin);
+				#endif
+				if (sendSPI(ss_pin, timing, message_buffer, length)) {
+					_wakePolling(ss_pin_i);
+				}
+			}
+		}
+		return true;
+	}
+
 	
-    bool sendSPI(int ss_pin, const char* message_buffer, size_t length) {
+    bool sendSPI(int ss_pin, Timing& timing, const char* message_buffer, size_t length) {
         size_t size = 0;	// No interrupts, so, not volatile
 		
 		#ifdef BROADCAST_SPI_DEBUG_1
@@ -101,6 +819,14 @@ protected:
 			return false;
 		}
 
+		if (timing.probe_block) _probeTiming(ss_pin, timing);
+		if (length > 0 && timing.version >= 3) {
+			return _exchangeBlockSPI(ss_pin, timing, message_buffer, length);
+		}
+		if (length > 0 && timing.version >= 2) {
+			return _sendBlockSPI(ss_pin, timing, message_buffer, length);
+		}
+
 		if (length > 0) {	// Don't send empty strings
 			
 			uint8_t c; // Avoid using 'char' while using values above 127
@@ -115,13 +841,13 @@ protected:
 
 				if (c != TALKIE_SB_VOID) {
 
-					delayMicroseconds(12);	// Makes sure it's processed by the slave (12us) (critical path)
+					delayMicroseconds(timing.byte_delay_us + 2);	// Makes sure it's processed by the slave (critical path)
 					c = _spi_instance->transfer(message_buffer[0]);
 
 					if (c == TALKIE_SB_READY) {	// Makes sure the Slave it's ready first
 					
 						for (uint8_t i = 1; i < length; i++) {
-							delayMicroseconds(send_delay_us);
+							delayMicroseconds(timing.byte_delay_us);
 							c = _spi_instance->transfer(message_buffer[i]);	// Receives the echoed message_buffer[i - 1]
 							if (c < 128) {
 								// Offset of 2 picks all mismatches than an offset of 1
@@ -145,16 +871,16 @@ protected:
 							}
 						}
 						// Checks the last 2 chars still to be checked
-						delayMicroseconds(12);    // Makes sure the Status Byte is sent
+						delayMicroseconds(timing.byte_delay_us + 2);    // Makes sure the Status Byte is sent
 						c = _spi_instance->transfer(TALKIE_SB_LAST);
 						if (c == message_buffer[length - 2]) {
-							delayMicroseconds(12);    // Makes sure the Status Byte is sent
+							delayMicroseconds(timing.byte_delay_us + 2);    // Makes sure the Status Byte is sent
 							c = _spi_instance->transfer(TALKIE_SB_END);
 							if (c == message_buffer[length - 1]) {	// Last char
 								size = length + 1;	// Just for error catch
 								// Makes sure Slave does the respective sets
 								for (uint8_t end_r = 0; c != TALKIE_SB_DONE && end_r < 3; end_r++) {	// Makes sure the receiving buffer of the Slave is deleted, for sure!
-									delayMicroseconds(10);
+									delayMicroseconds(timing.byte_delay_us);
 									c = _spi_instance->transfer(TALKIE_SB_END);
 								}
 								#ifdef BROADCAST_SPI_DEBUG_1
@@ -172,6 +898,11 @@ protected:
 							Serial.println(length - 2);
 							#endif
 						}
+						if (size == 0) {
+							if (_timingError(timing)) s--;
+						} else {
+							_timingClean(timing);
+						}
 					} else if (c == TALKIE_SB_BUSY) {
 						#ifdef BROADCAST_SPI_DEBUG_1
 						Serial.println(F("\t\tBUSY: Slave is busy, waiting a little."));
@@ -187,8 +918,10 @@ protected:
 						#ifdef BROADCAST_SPI_DEBUG_1
 						Serial.println(F("\t\tERROR: Received RECEIVE back, need to retry"));
 						#endif
+						if (_timingError(timing)) s--;	// The Slave didn't process the RECEIVE in time
 					} else {
-						size = 1;	// Nothing to be sent
+						size = 0;	// Tried again with the longer delay
+						if (_timingError(timing)) s--;	// Most likely a stale byte from a Slave still processing
 						#ifdef BROADCAST_SPI_DEBUG_1
 						Serial.print(F("\t\tERROR: Device NOT ready wit the reply: "));
 						Serial.println(c, HEX);
@@ -203,7 +936,7 @@ protected:
 				}
 
 				if (size == 0) {
-					delayMicroseconds(12);    // Makes sure the Status Byte is sent
+					delayMicroseconds(timing.byte_delay_us + 2);    // Makes sure the Status Byte is sent
 					_spi_instance->transfer(TALKIE_SB_ERROR);
 					#ifdef BROADCAST_SPI_DEBUG_1
 					Serial.println(F("\t\t\tSent ERROR back to the Slave"));
@@ -243,7 +976,7 @@ protected:
     }
 
 
-    size_t receiveSPI(int ss_pin, char* message_buffer, size_t buffer_size = TALKIE_BUFFER_SIZE) {
+    size_t receiveSPI(int ss_pin, Timing& timing, char* message_buffer, size_t buffer_size = TALKIE_BUFFER_SIZE) {
         size_t size = 0;	// No interrupts, so, not volatile
         uint8_t c;			// Avoid using 'char' while using values above 127
 
@@ -252,6 +985,11 @@ protected:
 		Serial.println(ss_pin);
 		#endif
 
+		if (timing.probe_block) _probeTiming(ss_pin, timing);
+		if (timing.version >= 2) {
+			return _receiveBlockSPI(ss_pin, timing, message_buffer, buffer_size);
+		}
+
         for (uint8_t r = 0; size == 0 && r < 3; r++) {
     
             digitalWrite(ss_pin, LOW);
@@ -262,33 +1000,33 @@ protected:
 			
 			if (c != TALKIE_SB_VOID) {
 
-				delayMicroseconds(12);	// Makes sure it's processed by the slave (12us) (critical path)
+				delayMicroseconds(timing.byte_delay_us + 2);	// Makes sure it's processed by the slave (critical path)
 				c = _spi_instance->transfer('\0');   // Dummy char to get the ACK
 
 				if (c == TALKIE_SB_READY) {	// Makes sure the Slave it's ready first
 					
-					delayMicroseconds(receive_delay_us);
+					delayMicroseconds(timing.byte_delay_us);
 					c = _spi_instance->transfer('\0');   // Dummy char to get the ACK
 					message_buffer[0] = c;
 
 					// Starts to receive all chars here
 					for (uint8_t i = 1; c < 128 && i < buffer_size; i++) { // First i isn't a char byte
-						delayMicroseconds(receive_delay_us);
+						delayMicroseconds(timing.byte_delay_us);
 						c = _spi_instance->transfer(message_buffer[i - 1]);
 						message_buffer[i] = c;
 						size = i;
 					}
 					if (c == TALKIE_SB_LAST) {
-						delayMicroseconds(receive_delay_us);    // Makes sure the Status Byte is sent
+						delayMicroseconds(timing.byte_delay_us);    // Makes sure the Status Byte is sent
 						c = _spi_instance->transfer(message_buffer[size]);  // Replies the last char to trigger END in return
 						#ifdef BROADCAST_SPI_DEBUG_1
 						Serial.println(F("\t\tReceived LAST"));
 						#endif
 						if (c == TALKIE_SB_END) {
-							delayMicroseconds(10);	// Makes sure the Status Byte is sent
+							delayMicroseconds(timing.byte_delay_us);	// Makes sure the Status Byte is sent
 							c = _spi_instance->transfer(TALKIE_SB_END);	// Replies the END to confirm reception and thus Slave buffer deletion
 							for (uint8_t end_s = 0; c != TALKIE_SB_DONE && end_s < 3; end_s++) {	// Makes sure the sending buffer of the Slave is deleted, for sure!
-								delayMicroseconds(10);
+								delayMicroseconds(timing.byte_delay_us);
 								c = _spi_instance->transfer(TALKIE_SB_END);
 							}
 							#ifdef BROADCAST_SPI_DEBUG_1
@@ -302,7 +1040,7 @@ protected:
 							#endif
 						}
 					} else if (size == buffer_size) {
-						delayMicroseconds(12);    // Makes sure the Status Byte is sent
+						delayMicroseconds(timing.byte_delay_us + 2);    // Makes sure the Status Byte is sent
 						_spi_instance->transfer(TALKIE_SB_FULL);
 						size = 1;	// Try no more
 						#ifdef BROADCAST_SPI_DEBUG_1
@@ -314,6 +1052,11 @@ protected:
 						Serial.println(F("\t\tERROR: Receiving sequence wasn't followed"));
 						#endif
 					}
+					if (size == 0) {
+						if (_timingError(timing)) r--;
+					} else {
+						_timingClean(timing);
+					}
 				} else if (c == TALKIE_SB_NONE) {
 					size = 1; // Nothing received
 					#ifdef BROADCAST_SPI_DEBUG_2
@@ -327,6 +1070,7 @@ protected:
 					#ifdef BROADCAST_SPI_DEBUG_1
 					Serial.println(F("\t\tERROR: Received SEND back, need to retry"));
 					#endif
+					if (_timingError(timing)) r--;	// The Slave didn't process the SEND in time
 				} else if (c == TALKIE_SB_FULL) {
 					#ifdef BROADCAST_SPI_DEBUG_1
 					Serial.println(F("\t\tERROR: Slave buffer overflow"));
@@ -336,11 +1080,12 @@ protected:
 					Serial.print(F("\t\tERROR: Device NOT ready, received status message: "));
 					Serial.println(c, HEX);
 					#endif
-					size = 1; // Nothing received
+					size = 0;	// Tried again with the longer delay
+					if (_timingError(timing)) r--;	// Most likely a stale byte from a Slave still processing
 				}
 
 				if (size == 0) {
-					delayMicroseconds(12);    // Makes sure the Status Byte is sent
+					delayMicroseconds(timing.byte_delay_us + 2);    // Makes sure the Status Byte is sent
 					_spi_instance->transfer(TALKIE_SB_ERROR);    // Results from ERROR or NACK send by the Slave and makes Slave reset to NONE
 					#ifdef BROADCAST_SPI_DEBUG_1
 					Serial.println(F("\t\t\tSent ERROR back to the Slave"));
@@ -382,50 +1127,73 @@ protected:
     }
 
 
-    bool acknowledgeSPI(int ss_pin) {
+    /**
+     * @brief Asks the Slave to acknowledge twice and takes its version from the answer to the second ACK
+     * @param ss_pin The SS pin of the Slave
+     * @param byte_delay_us The delay between bytes
+     * @return The version, 1 for the Slaves answering ACK again, or 0 if not acknowledged
+     */
+	uint8_t _versionSPI(int ss_pin, uint8_t byte_delay_us) {
         uint8_t c; // Avoid using 'char' while using values above 127
-        bool acknowledge = false;
+		uint8_t version = 0;
+
+		digitalWrite(ss_pin, LOW);
+		delayMicroseconds(5);
+
+		// Asks the Slave to acknowledge readiness, its first reply says nothing, given that
+		// a Slave with the broadcast on only drives MISO after this byte
+		_spi_instance->transfer(TALKIE_SB_ACK);
+
+		delayMicroseconds(byte_delay_us + 2);
+		c = _spi_instance->transfer(TALKIE_SB_ACK);  // When the response is collected
+		
+		if (c == TALKIE_SB_ACK) {
+			#ifdef BROADCAST_SPI_DEBUG_1
+			Serial.println(F("\t\tAcknowledged"));
+			#endif
 
+			// Slaves with block frames answer the second ACK with their version, the older ones with ACK
+			delayMicroseconds(byte_delay_us + 2);
+			c = _spi_instance->transfer(TALKIE_SB_ERROR);	// Also resets the Slave
+			version = c >= 2 && c <= TALKIE_SPI_VERSION ? c : 1;
+		}
 		#ifdef BROADCAST_SPI_DEBUG_1
-		Serial.print(F("\tAcknowledging on pin: "));
-		Serial.println(ss_pin);
+		else {
+			Serial.println(F("\t\tNOT acknowledged"));
+		}
 		#endif
 
-        for (uint8_t a = 0; !acknowledge && a < 3; a++) {
-    
-            digitalWrite(ss_pin, LOW);
-            delayMicroseconds(5);
+		delayMicroseconds(5);
+		digitalWrite(ss_pin, HIGH);
+		return version;
+	}
 
-            // Asks the Slave to acknowledge readiness
-            c = _spi_instance->transfer(TALKIE_SB_ACK);
 
-			if (c != TALKIE_SB_VOID) {
+    bool acknowledgeSPI(int ss_pin, Timing& timing) {
+		uint8_t version = 0;
 
-				delayMicroseconds(12);
-				c = _spi_instance->transfer(TALKIE_SB_ACK);  // When the response is collected
-				
-				if (c == TALKIE_SB_ACK) {
-                	#ifdef BROADCAST_SPI_DEBUG_1
-                	Serial.println(F("\t\tAcknowledged"));
-					#endif
-					acknowledge = true;
-				}
-				#ifdef BROADCAST_SPI_DEBUG_1
-				else {
-					Serial.println(F("\t\tNOT acknowledged"));
-				}
-				#endif
-			}
-            #ifdef BROADCAST_SPI_DEBUG_1
-			else {
-                Serial.println(F("\t\tReceived VOID"));
-			}
-			#endif
+		#ifdef BROADCAST_SPI_DEBUG_1
+		Serial.print(F("\tAcknowledging on pin: "));
+		Serial.println(ss_pin);
+		#endif
 
-            delayMicroseconds(5);
-            digitalWrite(ss_pin, HIGH);
+        for (uint8_t a = 0; !version && a < 3; a++) {
+			version = _versionSPI(ss_pin, timing.byte_delay_us);
         }
 
+		// Not calibrated yet, a slow Slave answers the version late and seems a version 1 one,
+		// so, version 1 is only taken as such if given again with the longest delay
+		if (version == 1) {
+			uint8_t slow_version = _versionSPI(ss_pin, TALKIE_SPI_MAX_DELAY_US);
+			if (slow_version > 1) version = slow_version;
+		}
+		bool acknowledge = version > 0;
+
+        if (acknowledge) {
+			timing.version = version;
+			_calibrateSPI(ss_pin, timing);
+		}
+
         #ifdef BROADCAST_SPI_DEBUG_1
         if (acknowledge) {
             Serial.println(F("Slave is ready!"));
@@ -441,39 +1209,82 @@ protected:
     // Socket processing is always Half-Duplex because there is just one buffer to receive and other to send
     void _receive() override {
 
+		// A Slave frame that came along with a sent one is delivered first, like a polled one
+		if (_exchanged_length) {
+			JsonMessage exchanged_message;
+			memcpy(exchanged_message._write_buffer(), _exchanged_buffer, _exchanged_length);
+			exchanged_message._set_length(_exchanged_length);
+			_exchanged_length = 0;	// Before `_startTransmission`, that may exchange again
+			
+			uint8_t ss_pin_i = 0;
+			while (ss_pin_i < _ss_pins_count - 1 && _ss_pins[ss_pin_i] != _exchanged_ss_pin) ss_pin_i++;
+			_pollingOf(ss_pin_i).replies++;
+			if (exchanged_message._validate_json()) {
+				if (exchanged_message._process_checksum()) {
+					_learnRoute(exchanged_message.get_from_name(), ss_pin_i);
+				}
+				_actual_ss_pin_i = ss_pin_i;
+				_startTransmission(exchanged_message);
+			}
+		}
+
 		// Too many SPI sends to the Slaves asking if there is something to send will overload them, so, a timeout is needed
 		static uint16_t timeout = (uint16_t)micros();
 
-		if (micros() - timeout > 500) {
+		// With one attention line per Slave only the asserting ones are polled, so, no timeout is needed
+		bool attention_per_slave = _attention_pins_count && _attention_pins_count == _ss_pins_count;
+		if (attention_per_slave || micros() - timeout > 500) {
 			timeout = (uint16_t)micros();
 
-			if (_initiated) {
+			// A shared attention line not asserted means no Slave has anything to send
+			if (_initiated && !(_attention_pins_count == 1 && digitalRead(_attention_pins[0]) == HIGH)) {
 
 				#ifdef BROADCAST_SPI_DEBUG_TIMING
 				_reference_time = millis();
 				#endif
 
+				_ageRoutes();
 				JsonMessage new_message;
 				char* message_buffer = new_message._write_buffer();
 
-				for (uint8_t ss_pin_i = 0; ss_pin_i < _ss_pins_count; ss_pin_i++) {
+				uint8_t first_ss_pin_i = _next_ss_pin_i;
+				if (++_next_ss_pin_i >= _ss_pins_count) _next_ss_pin_i = 0;
+
+				for (uint8_t poll_i = 0; poll_i < _ss_pins_count; poll_i++) {
+					uint8_t ss_pin_i = first_ss_pin_i + poll_i;
+					if (ss_pin_i >= _ss_pins_count) ss_pin_i -= _ss_pins_count;
+
+					Polling& polling = _pollingOf(ss_pin_i);
+					if (attention_per_slave) {
+						if (digitalRead(_attention_pins[ss_pin_i]) == HIGH) continue;
+					} else if (polling.skip) {
+						polling.skip--;	// Idle Slave, polled less often
+						continue;
+					}
 					
-					size_t length = receiveSPI(_ss_pins[ss_pin_i], message_buffer);
-					if (length > 0) {
+					polling.polls++;
+					size_t length = receiveSPI(_ss_pins[ss_pin_i], _timingOf(ss_pin_i), message_buffer);
+					if (length == 0) {
+						// Doubles the rounds skipped while the Slave has nothing to send
+						polling.backoff = polling.backoff ? polling.backoff << 1 : 1;
+						if (polling.backoff > TALKIE_SPI_MAX_BACKOFF) polling.backoff = TALKIE_SPI_MAX_BACKOFF;
+						polling.skip = polling.backoff;
+					} else {
+						polling.replies++;
+						polling.backoff = 0;	// Replying Slaves are likely to have more to send
 						
+
 						new_message._set_length(length);
 						if (new_message._validate_json()) {
 							
-							if (new_message._process_checksum() && _names[_actual_ss_pin_i][0] == '\0') {
-								strcpy(_names[_actual_ss_pin_i], new_message.get_from_name());
+							if (new_message._process_checksum()) {
+								_learnRoute(new_message.get_from_name(), ss_pin_i);
 								
 								#ifdef BROADCAST_SPI_DEBUG
-								Serial.print(F("\tcheckJsonMessage2: Saved actual named pin index i: "));
-								Serial.println(_actual_ss_pin_i);
-								Serial.print(F("\tcheckJsonMessage4: Saved name: "));
-								Serial.println(_names[_actual_ss_pin_i]);
+								Serial.print(F("\tcheckJsonMessage2: Routed name: "));
+								Serial.println(new_message.get_from_name());
 								Serial.print(F("\tcheckJsonMessage5: Concerning actual pin: "));
-								Serial.println(_ss_pins[_actual_ss_pin_i]);
+								Serial.println(_ss_pins[ss_pin_i]);
 								#endif
 
 							}
@@ -540,21 +1351,13 @@ protected:
 				#ifdef BROADCAST_SPI_DEBUG
 				Serial.println(F("\t\t\t\t\tsend3: json_message TO is a String"));
 				Serial.print(F("\t\t\t\t\tsend4: Message name TO: "));
-				Serial.println(to_name);
+				Serial.println(json_message.get_to_name());
 				#endif
 
-				for (uint8_t ss_pin_i = 0; ss_pin_i < _ss_pins_count && ss_pin_i < TALKIE_MAX_NAMES; ++ss_pin_i) {
-					
-					#ifdef BROADCAST_SPI_DEBUG
-					Serial.print(F("\t\t\t\t\tsend5: Comparing to the name: "));
-					Serial.println(_names[ss_pin_i]);
-					#endif
-
-					if (strcmp(to_name, _names[ss_pin_i]) == 0) {
-						as_reply = true;
-						_actual_ss_pin_i = ss_pin_i;
-						break;
-					}
+				uint8_t ss_pin_i = _findRoute(to_name);
+				if (ss_pin_i < _ss_pins_count) {
+					as_reply = true;
+					_actual_ss_pin_i = ss_pin_i;
 				}
 			} else {
 				#ifdef BROADCAST_SPI_DEBUG
@@ -570,16 +1373,20 @@ protected:
 			size_t message_length = json_message._get_length();
 
 			if (as_reply) {
-				sendSPI(_ss_pins[_actual_ss_pin_i], message_buffer, message_length);
+				if (sendSPI(_ss_pins[_actual_ss_pin_i], _timingOf(_actual_ss_pin_i), message_buffer, message_length)) {
+					_wakePolling(_actual_ss_pin_i);	// A reply is likely to follow
+				}
 
 				#ifdef BROADCAST_SPI_DEBUG
 				Serial.print(F("\t\t\t\t\tsend4: --> Directly sent for the received pin --> "));
 				Serial.println(_actual_ss_pin_i);
 				#endif
 
-			} else {    // Broadcast mode
+			} else if (_ss_pins_count < 2 || !_broadcastBlockSPI(message_buffer, message_length)) {    // Broadcast mode
 				for (uint8_t ss_pin_i = 0; ss_pin_i < _ss_pins_count; ss_pin_i++) {
-					sendSPI(_ss_pins[ss_pin_i], message_buffer, message_length);
+					if (sendSPI(_ss_pins[ss_pin_i], _timingOf(ss_pin_i), message_buffer, message_length)) {
+						_wakePolling(ss_pin_i);
+					}
 				}
 				
 				#ifdef BROADCAST_SPI_DEBUG
@@ -588,8 +1395,12 @@ protected:
 
 			}
 			#else
-			for (uint8_t ss_pin_i = 0; ss_pin_i < _ss_pins_count; ss_pin_i++) {
-				sendSPI(_ss_pins[ss_pin_i], message_buffer, message_length);
+			if (_ss_pins_count < 2 || !_broadcastBlockSPI(message_buffer, message_length)) {
+				for (uint8_t ss_pin_i = 0; ss_pin_i < _ss_pins_count; ss_pin_i++) {
+					if (sendSPI(_ss_pins[ss_pin_i], _timingOf(ss_pin_i), message_buffer, message_length)) {
+						_wakePolling(ss_pin_i);
+					}
+				}
 			}
 			#ifdef BROADCAST_SPI_DEBUG
 			Serial.println(F("\t\t\t\t\tsend4: --> Broadcast sent to all pins -->"));
@@ -627,7 +1438,7 @@ protected:
 
 			_initiated = true;
 			for (uint8_t ss_pin_i = 0; ss_pin_i < _ss_pins_count; ss_pin_i++) {
-				if (!acknowledgeSPI(_ss_pins[ss_pin_i])) {
+				if (!acknowledgeSPI(_ss_pins[ss_pin_i], _timingOf(ss_pin_i))) {
 					_initiated = false;
 					break;
 				}
@@ -669,6 +1480,52 @@ public:
     const char* class_name() const override { return "SPI_ESP_Arduino_Master"; }
 
 
+    uint8_t get_polled_count() const override { return _ss_pins_count; }
+
+
+    bool get_poll_stats(uint8_t polled_i, uint16_t& polls, uint16_t& replies, uint16_t& errors) const override {
+		if (polled_i >= _ss_pins_count) return false;
+		uint8_t profile_i = polled_i < TALKIE_SPI_MAX_PROFILES ? polled_i : TALKIE_SPI_MAX_PROFILES - 1;
+		polls = _pollings[profile_i].polls;
+		replies = _pollings[profile_i].replies;
+		errors = _timings[profile_i].errors;
+		return true;
+	}
+
+
+    /**
+     * @brief Sets the open-drain attention lines the Slaves pull LOW while they have something to send
+     * @param attention_pins The attention pins, either one per SS pin (same order) or a single shared one
+     * @param attention_pins_count The amount of attention pins, 0 to go back to blind polling
+     * 
+     * @note With one line per Slave, the asserting Slaves are polled right away and the others never,
+     *       while a shared line keeps the 500us polling of all Slaves but only while asserted
+     */
+	void set_attention_pins(int* attention_pins, uint8_t attention_pins_count) {
+		if (attention_pins_count != 1 && attention_pins_count != _ss_pins_count) {
+			attention_pins_count = 0;	// Unusable setup, keeps polling them all
+		}
+		_attention_pins = attention_pins;
+		_attention_pins_count = attention_pins_count;
+		for (uint8_t attention_pin_i = 0; attention_pin_i < _attention_pins_count; attention_pin_i++) {
+			pinMode(_attention_pins[attention_pin_i], INPUT_PULLUP);
+		}
+	}
+
+
+    /**
+     * @brief Turns on or off the version 4 broadcast, writing each broadcast block frame to all Slaves
+	 *        at once instead of one by one, off by default
+     * @param broadcast true to broadcast when all Slaves answered version 4
+     * 
+     * @note The Slaves answer version 4 only with their own `set_broadcast(true)`, and each Slave MISO
+	 *       requires a series resistor, see the README
+     */
+	void set_broadcast(bool broadcast) {
+		_broadcast = broadcast;
+	}
+
+
     virtual void begin(SPIClass* spi_instance) {
 		
 		_spi_instance = spi_instance;
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""
+JsonTalkie - Json Talkie is intended for direct IoT communication.
+Original Copyright (c) 2025 Rui Seixas Monteiro. All right reserved.
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+https://github.com/ruiseixasm/JsonTalkie
+
+Reconstructs the per hop latency of each message from the events recorded by `TalkieTrace.hpp`.
+
+The events are read, from a file or the standard input, either as the `T,time_us,hop,node,message,identity`
+lines printed by `TalkieTrace::dump(Serial)` or as the json echoes of the `system trace` command.
+
+    python3 talkie_trace.py serial.log --names spy2,blue2,BroadcastESP_WiFi
+"""
+
+import argparse
+import json
+import sys
+from collections import defaultdict
+
+HOPS = ["received", "handled", "transmitted", "sending", "sent"]
+MESSAGES = ["noise", "talk", "channel", "ping", "call", "list", "system", "echo", "error"]
+SYS_TRACE = 10  # TalkieCodes::SystemValue::TALKIE_SYS_TRACE
+
+
+def name_hash(name):
+    """Same djb2 hash as `JsonMessage::_name_hash`, never 0."""
+    value = 5381
+    for char in name.encode():
+        value = (value * 33 + char) & 0xFFFF
+    return value or 1
+
+
+def parse_line(line):
+    line = line.strip()
+    if line.startswith("T,"):
+        fields = line[2:].split(",")
+        if len(fields) == 5:
+            return tuple(int(field) for field in fields)
+    elif line.startswith("{"):
+        try:
+            message = json.loads(line)
+        except ValueError:
+            return None
+        if message.get("s") == SYS_TRACE and all(str(nth) in message for nth in range(5)):
+            return tuple(int(message[str(nth)]) for nth in range(5))
+    return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Per hop latency of the TalkieTrace events")
+    parser.add_argument("file", nargs="?", help="the dumped events, the standard input if omitted")
+    parser.add_argument("--names", default="", help="comma separated Talker names and Socket class names")
+    parser.add_argument("--quiet", action="store_true", help="prints only the summary")
+    args = parser.parse_args()
+
+    nodes = {name_hash(name): name for name in args.names.split(",") if name}
+    source = open(args.file) if args.file else sys.stdin
+    events = sorted({event for event in map(parse_line, source) if event})
+    if not events:
+        sys.exit("No trace events found")
+
+    # The replies keep the identity of their requests, so, each identity is a request and its replies
+    flows = defaultdict(list)
+    for time_us, hop, node, message, identity in events:
+        flows[identity].append((time_us, hop, node, message))
+
+    transitions = defaultdict(list)
+    for identity, flow in sorted(flows.items(), key=lambda item: item[1][0][0]):
+        if not args.quiet:
+            print("identity %d, %d hops in %d us" % (identity, len(flow), flow[-1][0] - flow[0][0]))
+        previous = None
+        for time_us, hop, node, message in flow:
+            hop_name = HOPS[hop] if hop < len(HOPS) else str(hop)
+            if previous:
+                delta = time_us - previous[0]
+                transitions[(HOPS[previous[1]] if previous[1] < len(HOPS) else str(previous[1]), hop_name)].append(delta)
+            else:
+                delta = 0
+            if not args.quiet:
+                print("  %+8d us  %-12s %-8s %s" % (delta, hop_name,
+                    MESSAGES[message] if message < len(MESSAGES) else message, nodes.get(node, "#%d" % node)))
+            previous = (time_us, hop)
+
+    print("\n%-26s %6s %9s %9s %9s" % ("hop to hop", "count", "avg us", "min us", "max us"))
+    for (start, end), deltas in sorted(transitions.items(), key=lambda item: -len(item[1])):
+        print("%-26s %6d %9d %9d %9d" % ("%s > %s" % (start, end), len(deltas),
+            sum(deltas) // len(deltas), min(deltas), max(deltas)))
+
+
+if __name__ == "__main__":
+    main()
@@ -34,6 +34,7 @@ https://github.com/ruiseixasm/JsonTalkie
 
 #include <Arduino.h>    // Needed for Serial given that Arduino IDE only includes Serial in .ino files!
 #include "JsonMessage.hpp"
+#include "TalkieTrace.hpp"
 
 
 // #define BROADCASTSOCKET_DEBUG
@@ -41,6 +42,13 @@ https://github.com/ruiseixasm/JsonTalkie
 
 // Readjust if necessary
 #define MAX_NETWORK_PACKET_LIFETIME_MS 256UL    // 256 milliseconds
+#define TALKIE_MAX_SOURCES 4					// Senders which CALL timing is tracked at once
+#define TALKIE_RATE_BURST 8						// Requests a full token bucket lets through at once
+#ifdef __AVR__
+#define TALKIE_RATE_SOURCES 2					// Senders which request rate is limited at once
+#else
+#define TALKIE_RATE_SOURCES 4					// Senders which request rate is limited at once
+#endif
 
 using LinkType			= TalkieCodes::LinkType;
 using TalkerMatch 		= TalkieCodes::TalkerMatch;
@@ -73,15 +81,148 @@ protected:
 
     // Pointer PRESERVE the polymorphism while objects don't!
     uint8_t _max_delay_ms = 5;
-    bool _control_timing = false;
-    uint16_t _last_local_time = 0;
-    uint16_t _last_message_timestamp = 0;
     uint16_t _drops_count = 0;
 
+	#ifdef TALKIE_TRACE
+	uint16_t _trace_node = 0;	// The class name hash, 0 until hashed
+
+	/**
+	 * @brief Returns the class name hash, hashed once given that `class_name` isn't available at construction
+	 */
+	uint16_t _traceNode() {
+		if (!_trace_node) _trace_node = JsonMessage::_name_hash(class_name());
+		return _trace_node;
+	}
+	#endif
+
+	/**
+	 * @brief Timing of the last CALL received from a given sender
+	 * @note A `name_hash` of 0 marks a free slot
+	 */
+	struct Source {
+		uint16_t name_hash;
+		uint16_t last_local_time;
+		uint16_t last_message_timestamp;
+	};
+
+	// Each sender has its own clock, so, timestamps are only comparable per sender
+	Source _sources[TALKIE_MAX_SOURCES];
+
+	/**
+	 * @brief A token bucket, where each request takes 1000 tokens and each millisecond adds
+	 *        as many tokens as the rate in requests per second
+	 * @note Its time isn't truncated, so, a bucket idle for longer than 65 seconds doesn't wrap and is found full
+	 */
+	struct TokenBucket {
+		uint32_t last_local_time;
+		uint16_t tokens;
+	};
+
+	/**
+	 * @brief The token bucket of a given sender
+	 * @note A `name_hash` of 0 marks a free slot
+	 */
+	struct RateSource {
+		uint16_t name_hash;
+		TokenBucket bucket;
+	};
+
+	uint16_t _socket_rate = 0;	// Requests per second, 0 means unlimited
+	uint16_t _source_rate = 0;	// Requests per second of each sender, 0 means unlimited
+	uint16_t _limited_count = 0;
+	TokenBucket _socket_bucket = {0, TALKIE_RATE_BURST * 1000};
+	RateSource _rate_sources[TALKIE_RATE_SOURCES];
+
 	
     // Constructor
     BroadcastSocket() {
-		// Does nothing here
+		for (uint8_t source_i = 0; source_i < TALKIE_MAX_SOURCES; ++source_i) {
+			_sources[source_i].name_hash = 0;
+		}
+		for (uint8_t source_i = 0; source_i < TALKIE_RATE_SOURCES; ++source_i) {
+			_rate_sources[source_i].name_hash = 0;
+		}
+	}
+
+
+    /**
+     * @brief Takes a request worth of tokens from a bucket, refilling it first
+     * @param bucket The token bucket
+     * @param rate The bucket rate in requests per second
+     * @param local_time The current local time
+     * @return Returns false if there aren't enough tokens, the request exceeds the rate
+     */
+	static bool _takeToken(TokenBucket& bucket, uint16_t rate, uint32_t local_time) {
+		uint32_t elapsed = local_time - bucket.last_local_time;
+		if (elapsed > TALKIE_RATE_BURST * 1000UL) elapsed = TALKIE_RATE_BURST * 1000UL;	// Full anyway
+		uint32_t tokens = bucket.tokens + elapsed * rate;
+		if (tokens > TALKIE_RATE_BURST * 1000UL) tokens = TALKIE_RATE_BURST * 1000UL;
+		bucket.last_local_time = local_time;
+		if (tokens < 1000) {
+			bucket.tokens = (uint16_t)tokens;
+			return false;
+		}
+		bucket.tokens = (uint16_t)(tokens - 1000);
+		return true;
+	}
+
+
+    /**
+     * @brief Checks a request against the Socket and its sender rates
+     * @param from_hash The hash of the sender name (`f` field), 0 if anonymous
+     * @return Returns false if the request exceeds any of the rates
+     * 
+     * @note A new sender takes the slot of the least recently heard one, with a full bucket
+     */
+	bool _withinRate(uint16_t from_hash) {
+		const uint32_t local_time = millis();
+		if (_source_rate && from_hash) {
+			uint8_t rate_i = 0;
+			uint32_t oldest_age = 0;
+			for (uint8_t slot_i = 0; slot_i < TALKIE_RATE_SOURCES; ++slot_i) {
+				if (_rate_sources[slot_i].name_hash == from_hash) {
+					rate_i = slot_i;
+					break;
+				}
+				// Free slots count as the oldest possible ones
+				uint32_t age = _rate_sources[slot_i].name_hash
+					? local_time - _rate_sources[slot_i].bucket.last_local_time : 0xFFFFFFFF;
+				if (age > oldest_age) {
+					oldest_age = age;
+					rate_i = slot_i;
+				}
+			}
+			RateSource& source = _rate_sources[rate_i];
+			if (source.name_hash != from_hash) {
+				source.name_hash = from_hash;
+				source.bucket = {local_time, TALKIE_RATE_BURST * 1000};
+			}
+			if (!_takeToken(source.bucket, _source_rate, local_time)) return false;
+		}
+		return !_socket_rate || _takeToken(_socket_bucket, _socket_rate, local_time);
+	}
+
+
+    /**
+     * @brief Gets the timing slot of a sender, taking a free or the oldest one if not tracked
+     * @param name_hash The hash of the sender name (`f` field)
+     * @param local_time The current truncated local time
+     * @return The source slot, with `name_hash` 0 if it's a new one
+     */
+	Source& _getSource(uint16_t name_hash, uint16_t local_time) {
+		uint8_t source_i = 0;
+		uint16_t oldest_age = 0;
+		for (uint8_t slot_i = 0; slot_i < TALKIE_MAX_SOURCES; ++slot_i) {
+			if (_sources[slot_i].name_hash == name_hash) return _sources[slot_i];
+			// Free slots count as the oldest possible ones
+			uint16_t age = _sources[slot_i].name_hash ? (uint16_t)(local_time - _sources[slot_i].last_local_time) : 0xFFFF;
+			if (age > oldest_age) {
+				oldest_age = age;
+				source_i = slot_i;
+			}
+		}
+		_sources[source_i].name_hash = 0;
+		return _sources[source_i];
 	}
 
 
@@ -97,14 +238,12 @@ protected:
      * @param json_message A json message to be transmitted to the repeater
 	 * 
      * @note Before calling this method, the `JsonMessage` methods `_validate_json` and `_process_checksum`
-	 *       shall be called first
+	 *       shall be called first. It's virtual so that `ESP_TaskSocket` can queue it from its own task.
      */
-    void _startTransmission(JsonMessage& json_message) {
+    virtual void _startTransmission(JsonMessage& json_message) {
 
-		#ifdef MESSAGE_DEBUG_TIMING
-		Serial.print("\n\t");
-		Serial.print(class_name());
-		Serial.print(": ");
+		#ifdef TALKIE_TRACE
+		TalkieTrace::instance()._record(TalkieTrace::Hop::TALKIE_HOP_RECEIVED, _traceNode(), json_message);
 		#endif
 			
 		#ifdef BROADCASTSOCKET_DEBUG_NEW
@@ -119,10 +258,23 @@ protected:
 		Serial.println(checksum);
 		#endif
 		
+		// Requests are limited in rate, the replies come from requests already let through
+		if ((_socket_rate || _source_rate) && json_message.get_message_value() < MessageValue::TALKIE_MSG_ECHO
+				&& !_withinRate(json_message.get_from_hash())) {
+
+			#ifdef BROADCASTSOCKET_DEBUG
+			Serial.println(F("handleTransmission2: Request over the rate dropped"));
+			#endif
+
+			_limited_count++;
+			return;
+		}
+
 		if (_max_delay_ms > 0) {
 
 			MessageValue message_code = json_message.get_message_value();
-			if (message_code == MessageValue::TALKIE_MSG_CALL) {
+			uint16_t from_hash = json_message.get_from_hash();
+			if (message_code == MessageValue::TALKIE_MSG_CALL && from_hash) {
 
 				uint16_t message_timestamp = json_message.get_timestamp();
 
@@ -137,14 +289,15 @@ protected:
 				#endif
 			
 				const uint16_t local_time = (uint16_t)millis();
+				Source& source = _getSource(from_hash, local_time);
 				
-				if (_control_timing) {
+				if (source.name_hash) {
 					
-					const uint16_t remote_delay = _last_message_timestamp - message_timestamp;  // Package received after
+					const uint16_t remote_delay = source.last_message_timestamp - message_timestamp;  // Package received after
 
 					if (remote_delay > 0 && remote_delay < MAX_NETWORK_PACKET_LIFETIME_MS) {    // Out of order package
 						const uint16_t allowed_delay = static_cast<uint16_t>(_max_delay_ms);
-						const uint16_t local_delay = local_time - _last_local_time;
+						const uint16_t local_delay = local_time - source.last_local_time;
 						#ifdef BROADCASTSOCKET_DEBUG
 						Serial.print(F("handleTransmission7: Local delay: "));
 						Serial.println(local_delay);
@@ -164,22 +317,13 @@ protected:
 						}
 					}
 				}
-				_last_local_time = local_time;
-				_last_message_timestamp = message_timestamp;
-				_control_timing = true;
+				source.name_hash = from_hash;
+				source.last_local_time = local_time;
+				source.last_message_timestamp = message_timestamp;
 			}
 		}
 
-		#ifdef MESSAGE_DEBUG_TIMING
-		Serial.print(millis() - json_message._reference_time);
-		#endif
-		
 		_transmitToRepeater(json_message);
-		
-		#ifdef MESSAGE_DEBUG_TIMING
-		Serial.print(" | ");
-		Serial.print(millis() - json_message._reference_time);
-		#endif
     }
 
 	
@@ -202,6 +346,25 @@ protected:
     virtual bool _send(const JsonMessage& json_message) = 0;
 
 
+    /**
+     * @brief Updates a CRC-16/CCITT-FALSE with one more byte, without loops (fast enough for an ISR)
+     * @param crc The CRC so far, starting with 0xFFFF
+     * @param data The byte to add
+     * @return The updated CRC
+     * 
+     * @note Shared by the Sockets framing their bytes, like the SPI and the Serial SLIP ones,
+     *       the CRC of some data followed by its own CRC (MSB first) is always 0
+     */
+	static inline uint16_t _crc16(uint16_t crc, uint8_t data) {
+		crc = (crc >> 8) | (crc << 8);
+		crc ^= data;
+		crc ^= (crc & 0xFF) >> 4;
+		crc ^= crc << 12;
+		crc ^= (crc & 0xFF) << 5;
+		return crc;
+	}
+
+
 public:
     // Delete copy/move operations
     BroadcastSocket(const BroadcastSocket&) = delete;
@@ -223,8 +386,12 @@ public:
         // In theory, a UDP packet on a local area network (LAN) could survive
         // for about 4.25 minutes (255 seconds).
         // BUT in practice it won't more that 256 milliseconds given that is a Ethernet LAN
-        if (_control_timing && (uint16_t)millis() - _last_local_time > MAX_NETWORK_PACKET_LIFETIME_MS) {
-            _control_timing = false;
+        const uint16_t local_time = (uint16_t)millis();
+        for (uint8_t source_i = 0; source_i < TALKIE_MAX_SOURCES; ++source_i) {
+            if (_sources[source_i].name_hash
+                    && (uint16_t)(local_time - _sources[source_i].last_local_time) > MAX_NETWORK_PACKET_LIFETIME_MS) {
+                _sources[source_i].name_hash = 0;
+            }
         }
         _receive();
     }
@@ -261,6 +428,55 @@ public:
     uint16_t get_drops_count() const { return _drops_count; }
 
 
+    /**
+     * @brief Get the maximum rate of requests received by the socket
+     * @return Returns the requests per second, 0 means unlimited
+     */
+    uint16_t get_socket_rate() const { return _socket_rate; }
+
+
+    /**
+     * @brief Get the maximum rate of requests received from each sender
+     * @return Returns the requests per second, 0 means unlimited
+     */
+    uint16_t get_source_rate() const { return _source_rate; }
+
+
+    /**
+     * @brief Get the total amount of requests dropped for exceeding the rates
+     * @return Returns the number of dropped requests
+     */
+    uint16_t get_limited_count() const { return _limited_count; }
+
+
+    /**
+     * @brief Get the messages dropped for a full queue, like the one between cores of `ESP_TaskSocket`
+     * @return Returns 0 for sockets without queues
+     */
+    virtual uint16_t get_overflows_count() const { return 0; }
+
+
+    /**
+     * @brief Get the amount of devices polled by this socket, like SPI Slaves
+     * @return Returns 0 for sockets that don't poll
+     */
+    virtual uint8_t get_polled_count() const { return 0; }
+
+
+    /**
+     * @brief Get the polling statistics of a polled device
+     * @param polled_i The index of the polled device
+     * @param polls Times the device was asked for a message
+     * @param replies Messages received from the device
+     * @param errors Transfer errors with the device
+     * @return Returns false if there is no such device
+     */
+    virtual bool get_poll_stats(uint8_t polled_i, uint16_t& polls, uint16_t& replies, uint16_t& errors) const {
+		(void)polled_i; (void)polls; (void)replies; (void)errors;
+		return false;
+	}
+
+
     // ============================================
     // SETTERS - FIELD MODIFICATION
     // ============================================
@@ -293,6 +509,19 @@ public:
 	 *       this only applies to `CALL` messages value
      */
     void set_max_delay(uint8_t max_delay_ms = 5) { _max_delay_ms = max_delay_ms; }
+
+
+    /**
+     * @brief Sets the maximum rates of requests received, above which they are dropped
+     * @param socket_rate The requests per second of the whole socket
+     * @param source_rate The requests per second of each sender
+     * 
+     * @note A rate of `0` means unlimited, each rate allows bursts of `TALKIE_RATE_BURST` requests
+     */
+    void set_rate(uint16_t socket_rate, uint16_t source_rate = 0) {
+		_socket_rate = socket_rate;
+		_source_rate = source_rate;
+	}
 	
 
 	/**
@@ -312,18 +541,18 @@ public:
 		Serial.println();  // optional: just to add a newline after the JSON
 		#endif
 
-		#ifdef MESSAGE_DEBUG_TIMING
-		Serial.print(" | ");
-		Serial.print(millis() - json_message._reference_time);
+		#ifdef TALKIE_TRACE
+		TalkieTrace::instance()._record(TalkieTrace::Hop::TALKIE_HOP_SENDING, _traceNode(), json_message);
 		#endif
 			
 		if (json_message._get_length() && json_message._insert_checksum()) {
 			
 			message_sent = _send(json_message);
 
-			#ifdef MESSAGE_DEBUG_TIMING
-			Serial.print(" | ");
-			Serial.print(millis() - json_message._reference_time);
+			#ifdef TALKIE_TRACE
+			if (message_sent) {
+				TalkieTrace::instance()._record(TalkieTrace::Hop::TALKIE_HOP_SENT, _traceNode(), json_message);
+			}
 			#endif
 		}
 		return message_sent;
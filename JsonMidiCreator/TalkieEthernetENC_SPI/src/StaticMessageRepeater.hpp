@@ -0,0 +1,172 @@
+/*
+JsonTalkie - Json Talkie is intended for direct IoT communication.
+Original Copyright (c) 2025 Rui Seixas Monteiro. All right reserved.
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Lesser General Public License for more details.
+https://github.com/ruiseixasm/JsonTalkie
+*/
+
+
+/**
+ * @file StaticMessageRepeater.hpp
+ * @brief A MessageRepeater with its topology fixed at compile time.
+ *
+ * @author Rui Seixas Monteiro
+ * @date Created: 2026-10-18
+ * @version 1.0.0
+ */
+
+#ifndef STATIC_MESSAGE_REPEATER_HPP
+#define STATIC_MESSAGE_REPEATER_HPP
+
+#include "MessageRepeater.hpp"
+
+
+/**
+ * @class StaticSockets
+ * @brief A compile time list of Sockets, given by their concrete types
+ *
+ * The Sockets are kept as the list of pointers the Repeater routes by, while their types make
+ * the loop over them unrolled by the compiler, with the `_loop` of each Socket called without
+ * going through its virtual table.
+ *
+ * @note Only that call is direct, the `_receive` and `_send` called from it and by the routing
+ *       still go through the virtual table.
+ *
+ * Example:
+ * ```
+ * using UplinkedSockets = StaticSockets<SocketSerial, SocketUDP>;
+ * UplinkedSockets uplinked_sockets(serial_socket, udp_socket);
+ * ```
+ */
+template <class... Sockets>
+class StaticSockets {
+private:
+
+	BroadcastSocket* const _sockets[sizeof...(Sockets) + 1];	// Ends with nullptr, so, never empty
+
+
+	template <uint8_t SOCKET_J>
+	void _loopSockets() {}
+
+	template <uint8_t SOCKET_J, class Socket, class... Others>
+	void _loopSockets() {
+		static_cast<Socket*>(_sockets[SOCKET_J])->Socket::_loop();
+		_loopSockets<SOCKET_J + 1, Others...>();
+	}
+
+public:
+
+	static const uint8_t count = sizeof...(Sockets);
+
+	StaticSockets(Sockets&... sockets) : _sockets{&sockets..., nullptr} {}
+
+
+	/** @brief Returns the list of Sockets as given to the `MessageRepeater` */
+	BroadcastSocket* const* _getSockets() const { return _sockets; }
+
+
+	/** @brief Calls the `_loop` of each Socket, directly given its concrete type */
+	void _loop() {
+		_loopSockets<0, Sockets...>();
+	}
+};
+
+
+/**
+ * @class StaticLinks
+ * @brief Keeps the Sockets lists of a `StaticMessageRepeater`, being constructed before its `MessageRepeater`
+ */
+template <class UplinkedSockets, class DownlinkedSockets>
+class StaticLinks {
+protected:
+
+	UplinkedSockets _up_sockets;
+	DownlinkedSockets _down_sockets;
+
+	StaticLinks(const UplinkedSockets& uplinked_sockets, const DownlinkedSockets& downlinked_sockets)
+		: _up_sockets(uplinked_sockets), _down_sockets(downlinked_sockets) {}
+};
+
+
+/**
+ * @class StaticMessageRepeater
+ * @brief The MessageRepeater with its Sockets types and Talkers counts given at compile time
+ *
+ * It's a plain `MessageRepeater`, routing by the same code, with its `loop` over the Sockets
+ * unrolled and the ones over the Talkers bounded by constants. The routing itself still calls
+ * the Sockets `_send` and the Talkers through their virtual tables.
+ *
+ * Example:
+ * ```
+ * using UplinkedSockets = StaticSockets<SocketSerial>;
+ * using DownlinkedSockets = StaticSockets<SPI_Arduino_Arduino_Master_Multiple>;
+ * JsonTalker* downlinked_talkers[] = { &talker };
+ * StaticMessageRepeater<UplinkedSockets, sizeof(downlinked_talkers)/sizeof(JsonTalker*), DownlinkedSockets> message_repeater(
+ *         UplinkedSockets(serial_socket), downlinked_talkers, DownlinkedSockets(spi_socket)
+ *     );
+ * ```
+ *
+ * @tparam UplinkedSockets A `StaticSockets` list with the uplinked Sockets
+ * @tparam DOWNLINKED_TALKERS The amount of downlinked Talkers
+ * @tparam DownlinkedSockets A `StaticSockets` list with the downlinked Sockets
+ * @tparam UPLINKED_TALKERS The amount of uplinked Talkers
+ */
+template <class UplinkedSockets, uint8_t DOWNLINKED_TALKERS,
+		class DownlinkedSockets = StaticSockets<>, uint8_t UPLINKED_TALKERS = 0>
+class StaticMessageRepeater : private StaticLinks<UplinkedSockets, DownlinkedSockets>, public MessageRepeater {
+private:
+
+	using Links = StaticLinks<UplinkedSockets, DownlinkedSockets>;
+
+	JsonTalker* const* const _down_talkers;
+	JsonTalker* const* const _up_talkers;
+
+public:
+
+    // Constructor
+    StaticMessageRepeater(
+			const UplinkedSockets& uplinked_sockets,
+			JsonTalker* const* const downlinked_talkers,
+			const DownlinkedSockets& downlinked_sockets = DownlinkedSockets(),
+			JsonTalker* const* const uplinked_talkers = nullptr
+		)
+        : Links(uplinked_sockets, downlinked_sockets),
+		MessageRepeater(
+			Links::_up_sockets._getSockets(), UplinkedSockets::count,
+			downlinked_talkers, DOWNLINKED_TALKERS,
+			Links::_down_sockets._getSockets(), DownlinkedSockets::count,
+			uplinked_talkers, UPLINKED_TALKERS
+		),
+		_down_talkers(downlinked_talkers), _up_talkers(uplinked_talkers) {}
+
+
+	/**
+	 * @brief Method intended to be called from the Arduino sketch `loop()` function.
+	 *
+	 * @note Same as the MessageRepeater `loop()`, with the Sockets loops unrolled.
+	 */
+    void loop() {
+		#ifdef TALKIE_DEFERRED_BULK
+		_budgetBulk();
+		#endif
+		Links::_up_sockets._loop();
+		for (uint8_t talker_i = 0; talker_i < DOWNLINKED_TALKERS; ++talker_i) {
+			_down_talkers[talker_i]->_loop();
+		}
+		Links::_down_sockets._loop();
+		for (uint8_t talker_i = 0; talker_i < UPLINKED_TALKERS; ++talker_i) {
+			_up_talkers[talker_i]->_loop();
+		}
+    }
+
+};
+
+
+#endif // STATIC_MESSAGE_REPEATER_HPP
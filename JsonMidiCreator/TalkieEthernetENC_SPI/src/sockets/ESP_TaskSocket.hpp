@@ -0,0 +1,204 @@
+/*
+JsonTalkie - Json Talkie is intended for direct IoT communication.
+Original Copyright (c) 2025 Rui Seixas Monteiro. All right reserved.
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Lesser General Public License for more details.
+https://github.com/ruiseixasm/JsonTalkie
+*/
+#ifndef ESP_TASK_SOCKET_HPP
+#define ESP_TASK_SOCKET_HPP
+
+#include "../BroadcastSocket.h"
+
+#ifndef ARDUINO_ARCH_ESP32
+#error "ESP_TaskSocket requires an ESP32 (FreeRTOS tasks)"
+#endif
+
+
+// #define ESP_TASK_SOCKET_DEBUG
+
+#define TALKIE_TASK_RING 16					///< Messages queued each way between the cores (power of 2)
+#define TALKIE_TASK_STACK 4096				///< Stack size in bytes of the Socket task
+#define TALKIE_TASK_IDLE_TICKS 1			///< Ticks the Socket task sleeps when there is nothing to do
+#define TALKIE_TASK_FULL_TICKS 2			///< Ticks waited for a free slot of a full ring before dropping
+
+
+/**
+ * @class ESP_TaskSocket
+ * @brief Runs the `_receive` and `_send` of a Socket in a FreeRTOS task pinned to its own core
+ * @tparam Socket The Socket class doing the actual I/O, like `BroadcastESP_WiFi`
+ *
+ * The Arduino `loop()`, and so the Repeater, the routing and the Manifestos loops, runs on core 1,
+ * while the Socket task, on core 0, polls the network and sends the queued messages. Both exchange
+ * whole `JsonMessage` slots through two single producer single consumer rings, one each way,
+ * without mutexes, so, a network burst no longer stalls the Manifestos timing.
+ *
+ * @note Until `startTask` is called, it works as the `Socket` itself, all in the same loop.
+ *       After it, the `Socket` I/O methods shall no longer be called from the sketch.
+ */
+template <class Socket>
+class ESP_TaskSocket : public Socket {
+protected:
+
+	/**
+	 * @brief A single producer single consumer ring of messages
+	 * @note The `head` is only written by the producer and the `tail` by the consumer, each one
+	 *       published with release ordering after its slot is written or read, as the other core sees it.
+	 */
+	struct Ring {
+		JsonMessage slots[TALKIE_TASK_RING];
+		uint8_t head = 0;
+		uint8_t tail = 0;
+
+		bool full() const {
+			return (uint8_t)(head - __atomic_load_n(&tail, __ATOMIC_ACQUIRE)) == TALKIE_TASK_RING;
+		}
+		bool empty() const { return __atomic_load_n(&head, __ATOMIC_ACQUIRE) == tail; }
+		/** @brief Waits, a tick at a time, for the consumer to free a slot, returns false if still full */
+		bool wait() const {
+			for (uint8_t tick_i = 0; tick_i < TALKIE_TASK_FULL_TICKS && full(); ++tick_i) {
+				vTaskDelay(1);
+			}
+			return !full();
+		}
+		JsonMessage& front() { return slots[tail & (TALKIE_TASK_RING - 1)]; }
+		JsonMessage& back() { return slots[head & (TALKIE_TASK_RING - 1)]; }
+		void push() { __atomic_store_n(&head, (uint8_t)(head + 1), __ATOMIC_RELEASE); }
+		void pop() { __atomic_store_n(&tail, (uint8_t)(tail + 1), __ATOMIC_RELEASE); }
+	};
+
+	Ring _received;		// Produced by the Socket task, consumed by the Repeater loop
+	Ring _sending;		// Produced by the Repeater loop, consumed by the Socket task
+	TaskHandle_t _task = nullptr;
+	bool _tasked = false;	// Set before the task starts, it may run before `_task` is even set
+	uint16_t _received_overflows = 0;	// Written by the Socket task only
+	uint16_t _sending_overflows = 0;	// Written by the Repeater loop only
+
+
+    // Constructor
+    ESP_TaskSocket() : Socket() {}
+
+
+	/**
+	 * @brief The Socket task, sending the queued messages first, given that they are replies
+	 *        already waiting, and then receiving the next ones
+	 */
+	static void _socketTask(void* parameter) {
+		ESP_TaskSocket* self = static_cast<ESP_TaskSocket*>(parameter);
+		for (;;) {
+			bool busy = false;
+			while (!self->_sending.empty()) {
+				self->Socket::_send(self->_sending.front());
+				self->_sending.pop();
+				busy = true;
+			}
+			uint8_t received_head = self->_received.head;
+			self->Socket::_receive();
+			busy = busy || self->_received.head != received_head;
+			if (!busy) vTaskDelay(TALKIE_TASK_IDLE_TICKS);	// Lets the idle task feed the watchdog
+		}
+	}
+
+
+	/**
+	 * @brief Called by the `Socket::_receive` with each new message, that in the task is queued
+	 *        instead, to be routed by the Repeater loop
+	 */
+	void _startTransmission(JsonMessage& json_message) override {
+		if (!_tasked) {
+			BroadcastSocket::_startTransmission(json_message);
+		} else if (!_received.wait()) {
+			__atomic_store_n(&_received_overflows, (uint16_t)(_received_overflows + 1), __ATOMIC_RELAXED);
+		} else {
+			_received.back() = json_message;
+			_received.push();
+		}
+	}
+
+
+	/**
+	 * @brief Routes the messages queued by the Socket task, at most a ring of them per loop
+	 */
+    void _receive() override {
+		if (!_tasked) {
+			Socket::_receive();
+			return;
+		}
+		for (uint8_t message_i = 0; message_i < TALKIE_TASK_RING && !_received.empty(); ++message_i) {
+			// Copied out so that the slot is freed before the routing, which may take long
+			JsonMessage json_message(_received.front());
+			_received.pop();
+
+			#ifdef ESP_TASK_SOCKET_DEBUG
+			Serial.print(F("\treceive1: From core "));
+			Serial.print(xPortGetCoreID());
+			Serial.print(F(" -->      "));
+			json_message.write_to(Serial);
+			Serial.println();
+			#endif
+
+			BroadcastSocket::_startTransmission(json_message);
+		}
+	}
+
+
+	/**
+	 * @brief Queues the message, already with its checksum, to be sent by the Socket task
+	 * @return Returns false if the ring stays full, the message being dropped
+	 */
+    bool _send(const JsonMessage& json_message) override {
+		if (!_tasked) return Socket::_send(json_message);
+		if (!_sending.wait()) {
+			_sending_overflows++;
+			return false;
+		}
+		_sending.back() = json_message;
+		_sending.push();
+		return true;
+	}
+
+
+public:
+
+    // Move ONLY the singleton instance method to subclass
+    static ESP_TaskSocket& instance() {
+        static ESP_TaskSocket instance;
+        return instance;
+    }
+
+
+    /**
+     * @brief Starts the Socket task, after the Socket is set up, like with `set_udp`
+     * @param core The core where the task runs, the Arduino `loop()` runs on core 1
+     * @param priority The FreeRTOS priority of the task
+     * @return Returns true if the task is running
+     */
+	bool startTask(BaseType_t core = 0, UBaseType_t priority = 1) {
+		if (_tasked) return true;
+		_tasked = true;
+		if (xTaskCreatePinnedToCore(
+				_socketTask, this->class_name(), TALKIE_TASK_STACK, this, priority, &_task, core
+			) != pdPASS) {
+			_tasked = false;
+		}
+		return _tasked;
+	}
+
+
+    /**
+     * @brief Get the messages dropped for a full ring, on both ways
+     * @return Returns the number of messages dropped between the cores
+     */
+	uint16_t get_overflows_count() const override {
+		return __atomic_load_n(&_received_overflows, __ATOMIC_RELAXED) + _sending_overflows;
+	}
+
+};
+
+#endif // ESP_TASK_SOCKET_HPP
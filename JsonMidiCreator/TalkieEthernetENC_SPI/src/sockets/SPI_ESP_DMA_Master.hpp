@@ -0,0 +1,650 @@
+/*
+JsonTalkie - Json Talkie is intended for direct IoT communication.
+Original Copyright (c) 2025 Rui Seixas Monteiro. All right reserved.
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Lesser General Public License for more details.
+https://github.com/ruiseixasm/JsonTalkie
+*/
+#ifndef SPI_ESP_DMA_MASTER_HPP
+#define SPI_ESP_DMA_MASTER_HPP
+
+
+#include "../BroadcastSocket.h"
+extern "C" {
+    #include "driver/spi_master.h"
+    #include "driver/gpio.h"
+}
+
+// #define BROADCAST_SPI_DEBUG
+
+
+#define ENABLE_DIRECT_ADDRESSING
+
+
+#define TALKIE_DMA_MAGIC 0xA5				///< First byte of every frame, a floating MISO reads 0xFF instead
+#define TALKIE_DMA_HEADER_SIZE 6			///< Magic, length, sequence, ack and the CRC-16 (MSB first)
+#define TALKIE_DMA_FRAME_SIZE ((TALKIE_DMA_HEADER_SIZE + TALKIE_BUFFER_SIZE + 3) & ~3)	///< Fixed frame, a multiple of 4 for the DMA
+#define TALKIE_DMA_SLOTS 4					///< Transactions that can be queued at once
+#define TALKIE_DMA_CLOCK_HZ 8000000			///< SPI clock, the ESP32 Slaves keep up with it
+#define TALKIE_DMA_POLL_US 200				///< Minimum time between polling rounds
+#define TALKIE_DMA_ACK_TIMEOUT_MS 50		///< Most a message is sent again without an ack, the Slave then taken as gone
+#define TALKIE_DMA_OUTBOX 16				///< Messages waiting for their Slave link to be free, on all links
+#define TALKIE_SPI_MAX_BACKOFF 8			///< Most polling rounds skipped by an idle Slave
+#define TALKIE_SPI_MAX_PROFILES 8			///< Slaves handled, each with its own link state and statistics
+#define TALKIE_MAX_ROUTES 16				///< Talker names routable to a SS pin (power of 2)
+#define TALKIE_ROUTE_LIFETIME_MS 30000UL	///< Routes not refreshed for longer than this are dropped
+#define TALKIE_ROUTE_NAME 4					///< Leading name characters kept per route, compared along its hash
+
+
+/**
+ * @brief ESP32 SPI Master for ESP32 Slaves, using the ESP-IDF driver with queued DMA transactions
+ *
+ * @note Every transaction is a fixed `TALKIE_DMA_FRAME_SIZE` full duplex frame, so, each one both
+ *       sends the Master frame and brings the frame the Slave had queued with `spi_slave_queue_trans`.
+ *       A frame is the magic byte, the payload length, the sequence of the payload, the sequence of the
+ *       last payload taken from the other side (ack), the CRC-16 of the length up to the last payload byte
+ *       and the payload, with an empty frame (length 0) meaning nothing to say.
+ *       Each Slave link has one message at a time in each direction, sent again in every transaction
+ *       until the other side acks its sequence, while the repeated ones are recognized by it and dropped.
+ *       The next messages to a Slave whose link is busy wait in the outbox, without blocking the loop.
+ *       Transactions are queued by `_send` and by the polling, while their results are only picked up
+ *       on the next `_receive`, so, the CPU keeps routing while the DMA clocks the bus.
+ *       Unlike `SPI_ESP_Arduino_Master`, this socket can't talk with the Arduino (AVR) Slaves.
+ */
+class SPI_ESP_DMA_Master : public BroadcastSocket {
+protected:
+
+	spi_host_device_t _host;
+	spi_device_handle_t _device = nullptr;
+	bool _initiated = false;
+    int* _ss_pins;
+    uint8_t _ss_pins_count = 0;
+	uint8_t _actual_ss_pin_i = 0;
+
+	/**
+	 * @brief A queued DMA transaction and its frames
+	 * @note The frames are members of the singleton, so, in internal and DMA capable memory
+	 */
+	struct Slot {
+		spi_transaction_t transaction;
+		uint8_t tx_frame[TALKIE_DMA_FRAME_SIZE] __attribute__((aligned(4)));
+		uint8_t rx_frame[TALKIE_DMA_FRAME_SIZE] __attribute__((aligned(4)));
+		uint8_t ss_pin_i;
+		bool queued;
+	};
+
+	Slot _slots[TALKIE_DMA_SLOTS];
+	uint8_t _queued_count = 0;
+
+	/**
+	 * @brief Received frames waiting for the next `_receive`, given that `_send` may have to pick up
+	 *        results too while waiting for a free slot
+	 */
+	struct Received {
+		uint8_t ss_pin_i;
+		uint8_t length;
+		char payload[TALKIE_BUFFER_SIZE];
+	};
+
+	Received _inbox[TALKIE_DMA_SLOTS];
+	uint8_t _inbox_head = 0;
+	uint8_t _inbox_count = 0;
+
+	/**
+	 * @brief Messages waiting for the link of their Slave to be free, in the order they were sent
+	 * @note Taken by the link as soon as it's freed, either by the ack or by the ack timeout
+	 */
+	struct Waiting {
+		uint8_t ss_pin_i;
+		uint8_t length;
+		char payload[TALKIE_BUFFER_SIZE];
+	};
+
+	Waiting _outbox[TALKIE_DMA_OUTBOX];
+	uint8_t _outbox_count = 0;
+	uint16_t _overflows_count = 0;	// Messages dropped for a full outbox
+	uint16_t _timeouts_count = 0;	// Messages dropped for not being acked in time
+
+	/**
+	 * @brief Talker name to SS pin route, learned from the received `f` fields
+	 * @note A `name_hash` of 0 marks a never used slot, while a `ss_pin_i` of 255
+	 *       marks a dropped one that still keeps the probing chain intact
+	 */
+	struct Route {
+		uint16_t name_hash;
+		char name[TALKIE_ROUTE_NAME];	// The leading characters, not null terminated if longer
+		uint16_t last_seen;		// Truncated millis() of the last message from the talker
+		uint8_t ss_pin_i;
+	};
+
+	Route _routes[TALKIE_MAX_ROUTES];
+
+	/**
+	 * @brief Per Slave polling state and statistics
+	 * @note Slaves that keep having nothing to send are polled exponentially less often,
+	 *       up to once every `TALKIE_SPI_MAX_BACKOFF` + 1 rounds, unless a message to them is waiting its ack
+	 */
+	struct Polling {
+		uint16_t polls;		// Transactions with the Slave
+		uint16_t replies;	// Messages received
+		uint16_t errors;	// Frames with a bad magic, length or CRC-16
+		uint8_t backoff;	// Rounds to skip after the next empty poll
+		uint8_t skip;		// Rounds still to be skipped
+		uint8_t in_flight;	// Queued transactions not yet picked up
+		uint8_t tx_seq;		// Sequence of the sending message, never 0
+		uint8_t rx_seq;		// Sequence of the last message taken, acked in every frame
+		uint8_t sending_length;		// The message waiting for its ack, 0 if none
+		uint16_t sending_since;		// Truncated millis() of when the link took the sending message
+		bool gone;			// Timed out with no valid frame since, so, none of its messages waits in the outbox
+		char sending_buffer[TALKIE_BUFFER_SIZE];
+	};
+
+	Polling _pollings[TALKIE_SPI_MAX_PROFILES];
+	uint8_t _next_ss_pin_i = 0;		// Round-robin start, so that no Slave is always polled last
+	uint32_t _last_poll_us = 0;
+
+
+    // Constructor
+    SPI_ESP_DMA_Master(int* ss_pins, uint8_t ss_pins_count, spi_host_device_t host) : BroadcastSocket(), _host(host) {
+
+        	_ss_pins = ss_pins;
+        	_ss_pins_count = ss_pins_count < TALKIE_SPI_MAX_PROFILES ? ss_pins_count : TALKIE_SPI_MAX_PROFILES;
+			for (uint8_t route_i = 0; route_i < TALKIE_MAX_ROUTES; ++route_i) {
+				_routes[route_i].name_hash = 0;
+				_routes[route_i].ss_pin_i = 255;
+			}
+			for (uint8_t profile_i = 0; profile_i < TALKIE_SPI_MAX_PROFILES; ++profile_i) {
+				_pollings[profile_i] = {};
+			}
+			for (uint8_t slot_i = 0; slot_i < TALKIE_DMA_SLOTS; ++slot_i) {
+				memset(&_slots[slot_i].transaction, 0, sizeof(spi_transaction_t));
+				_slots[slot_i].transaction.length = TALKIE_DMA_FRAME_SIZE * 8;	// In bits
+				_slots[slot_i].transaction.tx_buffer = _slots[slot_i].tx_frame;
+				_slots[slot_i].transaction.rx_buffer = _slots[slot_i].rx_frame;
+				_slots[slot_i].queued = false;
+			}
+			_max_delay_ms = 0;  // SPI is sequencial, no need to control out of order packages
+	}
+
+
+	// Manual SS, given that the driver only handles 3 hardware CS lines per host
+	static void IRAM_ATTR _selectSlave(spi_transaction_t* transaction) {
+		gpio_set_level((gpio_num_t)(intptr_t)transaction->user, 0);
+	}
+
+	static void IRAM_ATTR _deselectSlave(spi_transaction_t* transaction) {
+		gpio_set_level((gpio_num_t)(intptr_t)transaction->user, 1);
+	}
+
+
+    /**
+     * @brief Routes a talker name to the SS pin it was heard from
+     * @param name The talker name
+     * @param ss_pin_i The index of the SS pin
+     *
+     * @note Uses linear probing starting at the hash slot, when the table is full
+     *       the least recently heard route is the one replaced
+     */
+	void _learnRoute(const char* name, uint8_t ss_pin_i) {
+		if (!name) return;
+		uint16_t name_hash = JsonMessage::_name_hash(name);
+		uint16_t now = (uint16_t)millis();
+		uint8_t free_i = TALKIE_MAX_ROUTES;
+		uint8_t oldest_i = 0;
+		uint16_t oldest_age = 0;
+		for (uint8_t probe_i = 0; probe_i < TALKIE_MAX_ROUTES; ++probe_i) {
+			uint8_t route_i = (name_hash + probe_i) & (TALKIE_MAX_ROUTES - 1);
+			Route& route = _routes[route_i];
+			if (route.name_hash == name_hash && strncmp(route.name, name, TALKIE_ROUTE_NAME) == 0) {
+				route.ss_pin_i = ss_pin_i;	// Also revives a dropped route
+				route.last_seen = now;
+				return;
+			}
+			if (route.ss_pin_i == 255) {
+				if (free_i == TALKIE_MAX_ROUTES) free_i = route_i;
+				if (!route.name_hash) break;	// End of the chain, name not routed yet
+			} else if ((uint16_t)(now - route.last_seen) >= oldest_age) {
+				oldest_age = (uint16_t)(now - route.last_seen);
+				oldest_i = route_i;
+			}
+		}
+		if (free_i == TALKIE_MAX_ROUTES) free_i = oldest_i;
+		_routes[free_i].name_hash = name_hash;
+		for (uint8_t char_i = 0; char_i < TALKIE_ROUTE_NAME; ++char_i) {
+			_routes[free_i].name[char_i] = *name ? *name++ : '\0';	// Zero padded, not terminated if longer
+		}
+		_routes[free_i].last_seen = now;
+		_routes[free_i].ss_pin_i = ss_pin_i;
+	}
+
+
+    /**
+     * @brief Gets the SS pin index of a talker name
+     * @param name The talker name
+     * @return The SS pin index or 255 if the name isn't routed
+     * 
+     * @note Besides the hash, the leading name characters have to match too, so, a hash
+     *       collision falls back to the broadcast instead of reaching the wrong Slave
+     */
+	uint8_t _findRoute(const char* name) const {
+		if (name) {
+			uint16_t name_hash = JsonMessage::_name_hash(name);
+			for (uint8_t probe_i = 0; probe_i < TALKIE_MAX_ROUTES; ++probe_i) {
+				const Route& route = _routes[(name_hash + probe_i) & (TALKIE_MAX_ROUTES - 1)];
+				if (route.name_hash == name_hash && strncmp(route.name, name, TALKIE_ROUTE_NAME) == 0) return route.ss_pin_i;
+				if (!route.name_hash) break;
+			}
+		}
+		return 255;
+	}
+
+
+    /**
+     * @brief Drops the routes that weren't refreshed for more than `TALKIE_ROUTE_LIFETIME_MS`
+     *
+     * @note Called on every polling round, so the 16 bits ages never wrap around
+     */
+	void _ageRoutes() {
+		uint16_t now = (uint16_t)millis();
+		for (uint8_t route_i = 0; route_i < TALKIE_MAX_ROUTES; ++route_i) {
+			if (_routes[route_i].ss_pin_i != 255 && (uint16_t)(now - _routes[route_i].last_seen) > TALKIE_ROUTE_LIFETIME_MS) {
+				_routes[route_i].ss_pin_i = 255;
+			}
+		}
+	}
+
+
+    /**
+     * @brief Gets the polling state of a Slave
+     * @param ss_pin_i The index of the SS pin, below `TALKIE_SPI_MAX_PROFILES`
+     * @return The polling state
+     */
+	Polling& _pollingOf(uint8_t ss_pin_i) {
+		return _pollings[ss_pin_i];
+	}
+
+
+    /**
+     * @brief Writes a frame, the length up to the payload bytes protected by a CRC-16
+     * @param frame The `TALKIE_DMA_FRAME_SIZE` frame to be written
+     * @param payload The payload bytes, may be nullptr for an empty frame
+     * @param length The amount of payload bytes, up to `TALKIE_BUFFER_SIZE`
+     * @param seq The sequence of the payload
+     * @param ack The sequence of the last payload taken from the other side
+     */
+	static void _writeFrame(uint8_t* frame, const char* payload, uint8_t length, uint8_t seq, uint8_t ack) {
+		frame[0] = TALKIE_DMA_MAGIC;
+		frame[1] = length;
+		frame[2] = seq;
+		frame[3] = ack;
+		uint16_t crc = _crc16(_crc16(_crc16(0xFFFF, length), seq), ack);
+		for (uint8_t i = 0; i < length; i++) {
+			frame[TALKIE_DMA_HEADER_SIZE + i] = (uint8_t)payload[i];
+			crc = _crc16(crc, (uint8_t)payload[i]);
+		}
+		frame[4] = (uint8_t)(crc >> 8);
+		frame[5] = (uint8_t)crc;
+	}
+
+
+    /**
+     * @brief Checks a received frame
+     * @param frame The `TALKIE_DMA_FRAME_SIZE` frame received
+     * @return The payload length, 0 for an empty frame or -1 for a corrupted one
+     */
+	static int _readFrame(const uint8_t* frame) {
+		if (frame[0] != TALKIE_DMA_MAGIC || frame[1] > TALKIE_BUFFER_SIZE) return -1;
+		uint8_t length = frame[1];
+		uint16_t crc = _crc16(_crc16(_crc16(0xFFFF, length), frame[2]), frame[3]);
+		for (uint8_t i = 0; i < length; i++) {
+			crc = _crc16(crc, frame[TALKIE_DMA_HEADER_SIZE + i]);
+		}
+		if (frame[4] != (uint8_t)(crc >> 8) || frame[5] != (uint8_t)crc) return -1;
+		return length;
+	}
+
+
+    /**
+     * @brief Picks up the finished transactions, moving their received payloads into the inbox
+     * @param ticks_to_wait How long to wait for the first one, 0 to not wait at all
+     * @return true if at least one transaction was picked up
+     */
+	bool _collect(TickType_t ticks_to_wait) {
+		bool collected = false;
+		spi_transaction_t* done;
+		while (_queued_count && spi_device_get_trans_result(_device, &done, ticks_to_wait) == ESP_OK) {
+			ticks_to_wait = 0;	// Only the first one is waited for
+			collected = true;
+			Slot* slot = reinterpret_cast<Slot*>(done);	// The transaction is the first member
+			slot->queued = false;
+			_queued_count--;
+
+			Polling& polling = _pollingOf(slot->ss_pin_i);
+			if (polling.in_flight) polling.in_flight--;
+			polling.polls++;
+			int length = _readFrame(slot->rx_frame);
+			if (length < 0) {
+				polling.errors++;	// Nothing acked, so, both messages go again
+				continue;
+			}
+			polling.gone = false;
+			if (polling.sending_length && slot->rx_frame[3] == polling.tx_seq) {
+				polling.sending_length = 0;	// Acked, frees the link for the next message
+				_takeWaiting(slot->ss_pin_i);
+			}
+			if (length == 0) {
+				// Doubles the rounds skipped while the Slave has nothing to send
+				polling.backoff = polling.backoff ? polling.backoff << 1 : 1;
+				if (polling.backoff > TALKIE_SPI_MAX_BACKOFF) polling.backoff = TALKIE_SPI_MAX_BACKOFF;
+				polling.skip = polling.backoff;
+			} else {
+				polling.backoff = 0;	// Replying Slaves are likely to have more to send, and need the ack
+				polling.skip = 0;
+				// The same sequence is the message already taken, sent again while the ack was on its way
+				if (slot->rx_frame[2] != polling.rx_seq && _inbox_count < TALKIE_DMA_SLOTS) {
+					Received& received = _inbox[(_inbox_head + _inbox_count) % TALKIE_DMA_SLOTS];
+					received.ss_pin_i = slot->ss_pin_i;
+					received.length = (uint8_t)length;
+					memcpy(received.payload, slot->rx_frame + TALKIE_DMA_HEADER_SIZE, length);
+					_inbox_count++;
+					polling.rx_seq = slot->rx_frame[2];
+					polling.replies++;
+				}	// Otherwise, with the inbox full, it isn't acked and so the Slave sends it again
+			}
+		}
+		return collected;
+	}
+
+
+    /**
+     * @brief Queues a transaction with a Slave, waiting for a free slot if needed
+     * @param ss_pin_i The index of the SS pin
+     * @return true if queued
+     *
+     * @note The frame carries the message to the Slave still waiting for its ack, if any,
+     *       otherwise it's an empty (polling) frame, either way acking the last one taken
+     */
+	bool _queue(uint8_t ss_pin_i) {
+		if (_queued_count == TALKIE_DMA_SLOTS && !_collect(pdMS_TO_TICKS(10))) return false;
+		for (uint8_t slot_i = 0; slot_i < TALKIE_DMA_SLOTS; ++slot_i) {
+			Slot& slot = _slots[slot_i];
+			if (!slot.queued) {
+				Polling& polling = _pollingOf(ss_pin_i);
+				_writeFrame(slot.tx_frame, polling.sending_buffer, polling.sending_length, polling.tx_seq, polling.rx_seq);
+				slot.ss_pin_i = ss_pin_i;
+				slot.transaction.user = (void*)(intptr_t)_ss_pins[ss_pin_i];
+				if (spi_device_queue_trans(_device, &slot.transaction, 0) != ESP_OK) return false;
+				slot.queued = true;
+				_queued_count++;
+				polling.in_flight++;
+				return true;
+			}
+		}
+		return false;
+	}
+
+
+    /**
+     * @brief Makes a message the one a Slave link sends until acked
+     * @param ss_pin_i The index of the SS pin, with its link free
+     * @param payload The message bytes
+     * @param length The amount of message bytes
+     */
+	void _take(uint8_t ss_pin_i, const char* payload, uint8_t length) {
+		Polling& polling = _pollingOf(ss_pin_i);
+		memcpy(polling.sending_buffer, payload, length);
+		polling.sending_length = length;
+		polling.sending_since = (uint16_t)millis();
+		if (!++polling.tx_seq) polling.tx_seq = 1;	// 0 is never a message sequence
+		polling.backoff = 0;	// A reply is likely to follow
+		polling.skip = 0;
+	}
+
+
+    /**
+     * @brief Gives a just freed Slave link the first message waiting for it in the outbox, if any
+     * @param ss_pin_i The index of the SS pin
+     *
+     * @note It's sent by the next polling round, given that this may be called from `_collect`
+     */
+	void _takeWaiting(uint8_t ss_pin_i) {
+		for (uint8_t waiting_i = 0; waiting_i < _outbox_count; ++waiting_i) {
+			if (_outbox[waiting_i].ss_pin_i == ss_pin_i) {
+				_take(ss_pin_i, _outbox[waiting_i].payload, _outbox[waiting_i].length);
+				_outbox_count--;
+				for (; waiting_i < _outbox_count; ++waiting_i) {	// Keeps the order of the others
+					_outbox[waiting_i] = _outbox[waiting_i + 1];
+				}
+				return;
+			}
+		}
+	}
+
+
+    /**
+     * @brief Hands a message to a Slave link, to be sent until acked, without waiting for the link
+     * @param ss_pin_i The index of the SS pin
+     * @param payload The message bytes
+     * @param length The amount of message bytes
+     * @return true if queued, or left in the outbox while the link is busy
+     *
+     * @note A link busy with a previous message isn't waited for, the new one is left in the outbox
+     *       and the polling rounds send it once the previous one is acked or timed out, a link only
+     *       being free when none of its messages is waiting, so, they keep their order.
+     *       After a timeout, and until the Slave answers a valid frame, its link takes a message only
+     *       while free, the others being dropped as timed out too
+     */
+	bool _sendTo(uint8_t ss_pin_i, const char* payload, uint8_t length) {
+		Polling& polling = _pollingOf(ss_pin_i);
+		if (polling.sending_length) {
+			if (polling.gone) {
+				_timeouts_count++;	// Not filling the outbox for a Slave that isn't there
+				return false;
+			}
+			if (_outbox_count == TALKIE_DMA_OUTBOX) {
+				_overflows_count++;
+				return false;
+			}
+			Waiting& waiting = _outbox[_outbox_count++];
+			waiting.ss_pin_i = ss_pin_i;
+			waiting.length = length;
+			memcpy(waiting.payload, payload, length);
+			return true;
+		}
+		_take(ss_pin_i, payload, length);
+		return _queue(ss_pin_i);	// The polling rounds send it again until acked
+	}
+
+
+    void _receive() override {
+
+		if (_initiated) {
+
+			_collect(0);
+
+			// Delivers the received messages, each one is copied out first because
+			// `_startTransmission` may end up calling `_send`, and so, `_collect`
+			while (_inbox_count) {
+				Received& received = _inbox[_inbox_head];
+				_inbox_head = (_inbox_head + 1) % TALKIE_DMA_SLOTS;
+				_inbox_count--;
+
+				JsonMessage new_message;
+				char* message_buffer = new_message._write_buffer();
+				memcpy(message_buffer, received.payload, received.length);
+				new_message._set_length(received.length);
+				uint8_t ss_pin_i = received.ss_pin_i;
+				if (new_message._validate_json()) {
+					if (new_message._process_checksum()) {
+						_learnRoute(new_message.get_from_name(), ss_pin_i);
+					}
+
+					#ifdef BROADCAST_SPI_DEBUG
+					Serial.print(F("\treceive1: Received message: "));
+					Serial.write(message_buffer, received.length);
+					Serial.print(F(" from the SS pin: "));
+					Serial.println(_ss_pins[ss_pin_i]);
+					#endif
+
+					_actual_ss_pin_i = ss_pin_i;
+					_startTransmission(new_message);
+				}
+			}
+
+			// Polling round, empty frames that bring back whatever the Slaves have queued
+			if (micros() - _last_poll_us > TALKIE_DMA_POLL_US) {
+				_last_poll_us = micros();
+				_ageRoutes();
+
+				uint8_t first_ss_pin_i = _next_ss_pin_i;
+				if (++_next_ss_pin_i >= _ss_pins_count) _next_ss_pin_i = 0;
+
+				for (uint8_t poll_i = 0; poll_i < _ss_pins_count && _queued_count < TALKIE_DMA_SLOTS; poll_i++) {
+					uint8_t ss_pin_i = first_ss_pin_i + poll_i;
+					if (ss_pin_i >= _ss_pins_count) ss_pin_i -= _ss_pins_count;
+
+					Polling& polling = _pollingOf(ss_pin_i);
+					if (polling.sending_length && (uint16_t)((uint16_t)millis() - polling.sending_since) > TALKIE_DMA_ACK_TIMEOUT_MS) {
+						polling.sending_length = 0;	// Taken as gone, the message is dropped
+						polling.gone = true;
+						_timeouts_count++;
+						_takeWaiting(ss_pin_i);
+					}
+					if (polling.in_flight) continue;	// Its answer is still on the way
+					if (polling.skip && !polling.sending_length) {
+						polling.skip--;	// Idle Slave, polled less often
+						continue;
+					}
+					_queue(ss_pin_i);	// Sends again any message not yet acked
+				}
+			}
+		}
+    }
+
+
+    bool _send(const JsonMessage& json_message) override {
+
+		if (_initiated) {
+
+			const char* message_buffer = json_message._read_buffer();
+			uint8_t message_length = (uint8_t)json_message._get_length();
+
+			#ifdef BROADCAST_SPI_DEBUG
+			Serial.print(F("\t\t\t\t\tsend1: Sent message: "));
+			Serial.write(message_buffer, message_length);
+			Serial.println();
+			#endif
+
+			#ifdef ENABLE_DIRECT_ADDRESSING
+			uint8_t ss_pin_i = _findRoute(json_message.get_to_name());
+			if (ss_pin_i < _ss_pins_count) {
+				_actual_ss_pin_i = ss_pin_i;
+				return _sendTo(ss_pin_i, message_buffer, message_length);
+			}
+			#endif
+
+			bool queued = false;
+			for (uint8_t ss_pin_i = 0; ss_pin_i < _ss_pins_count; ss_pin_i++) {
+				queued = _sendTo(ss_pin_i, message_buffer, message_length) || queued;
+			}
+			return queued;
+		}
+        return false;
+    }
+
+
+public:
+
+    // Move ONLY the singleton instance method to subclass
+    static SPI_ESP_DMA_Master& instance(int* ss_pins, uint8_t ss_pins_count, spi_host_device_t host = HSPI_HOST) {
+        static SPI_ESP_DMA_Master instance(ss_pins, ss_pins_count, host);
+
+        return instance;
+    }
+
+    const char* class_name() const override { return "SPI_ESP_DMA_Master"; }
+
+
+    /**
+     * @brief Get the messages dropped for a full outbox, the one of the messages waiting for their link
+     * @return Returns the number of messages dropped
+     */
+	uint16_t get_overflows_count() const override { return _overflows_count; }
+
+
+    /**
+     * @brief Get the messages dropped for not being acked by their Slave within `TALKIE_DMA_ACK_TIMEOUT_MS`,
+	 *        and the ones to a Slave taken as gone while its link was busy
+     * @return Returns the number of messages dropped
+     */
+	uint16_t get_timeouts_count() const { return _timeouts_count; }
+
+
+    uint8_t get_polled_count() const override { return _ss_pins_count; }
+
+
+    bool get_poll_stats(uint8_t polled_i, uint16_t& polls, uint16_t& replies, uint16_t& errors) const override {
+		if (polled_i >= _ss_pins_count) return false;
+		const Polling& polling = _pollings[polled_i];
+		polls = polling.polls;
+		replies = polling.replies;
+		errors = polling.errors;
+		return true;
+	}
+
+
+    /**
+     * @brief Initializes the SPI bus with DMA and the SS pins
+     * @param sclk_pin The clock pin
+     * @param miso_pin The MISO pin
+     * @param mosi_pin The MOSI pin
+     * @return true if the bus and the device were set up
+     *
+     * @note Use it instead of `SPIClass::begin`, the driver owns the whole host
+     */
+	bool begin(int sclk_pin, int miso_pin, int mosi_pin) {
+
+		for (uint8_t ss_pin_i = 0; ss_pin_i < _ss_pins_count; ss_pin_i++) {
+			pinMode(_ss_pins[ss_pin_i], OUTPUT);
+			digitalWrite(_ss_pins[ss_pin_i], HIGH);
+			// A random start, so that after a reset the first message isn't taken as one sent again
+			_pollings[ss_pin_i].tx_seq = (uint8_t)random(1, 256);
+		}
+
+		spi_bus_config_t bus_config = {};
+		bus_config.mosi_io_num = mosi_pin;
+		bus_config.miso_io_num = miso_pin;
+		bus_config.sclk_io_num = sclk_pin;
+		bus_config.quadwp_io_num = -1;
+		bus_config.quadhd_io_num = -1;
+		bus_config.max_transfer_sz = TALKIE_DMA_FRAME_SIZE;
+
+		spi_device_interface_config_t device_config = {};
+		device_config.clock_speed_hz = TALKIE_DMA_CLOCK_HZ;
+		device_config.mode = 0;
+		device_config.spics_io_num = -1;	// SS pins handled by the callbacks below
+		device_config.queue_size = TALKIE_DMA_SLOTS;
+		device_config.pre_cb = _selectSlave;
+		device_config.post_cb = _deselectSlave;
+
+		_initiated = spi_bus_initialize(_host, &bus_config, SPI_DMA_CH_AUTO) == ESP_OK
+			&& spi_bus_add_device(_host, &device_config, &_device) == ESP_OK;
+
+		#ifdef BROADCAST_SPI_DEBUG
+		Serial.print(class_name());
+		Serial.println(_initiated ? F(": Socket initiated!") : F(": Socket NOT initiated!"));
+		#endif
+
+		return _initiated;
+	}
+};
+
+
+
+#endif // SPI_ESP_DMA_MASTER_HPP
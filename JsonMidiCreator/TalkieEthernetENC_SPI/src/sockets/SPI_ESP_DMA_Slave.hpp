@@ -0,0 +1,341 @@
+/*
+JsonTalkie - Json Talkie is intended for direct IoT communication.
+Original Copyright (c) 2025 Rui Seixas Monteiro. All right reserved.
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Lesser General Public License for more details.
+https://github.com/ruiseixasm/JsonTalkie
+*/
+#ifndef SPI_ESP_DMA_SLAVE_HPP
+#define SPI_ESP_DMA_SLAVE_HPP
+
+
+#include "../BroadcastSocket.h"
+extern "C" {
+    #include "driver/spi_slave.h"
+}
+
+// #define BROADCAST_SPI_DEBUG
+
+
+#define TALKIE_DMA_MAGIC 0xA5				///< First byte of every frame, a floating MISO reads 0xFF instead
+#define TALKIE_DMA_HEADER_SIZE 6			///< Magic, length, sequence, ack and the CRC-16 (MSB first)
+#define TALKIE_DMA_FRAME_SIZE ((TALKIE_DMA_HEADER_SIZE + TALKIE_BUFFER_SIZE + 3) & ~3)	///< Fixed frame, a multiple of 4 for the DMA
+#define TALKIE_DMA_SLAVE_SLOTS 3			///< Transactions kept queued, a message waits at most this many polls
+#define TALKIE_DMA_SLAVE_RING 4				///< Finished transactions handed to `_receive` (power of 2, >= slots)
+#define TALKIE_DMA_SLAVE_WAIT_MS 5			///< Most a send waits for the previous message to be acked by the Master
+
+
+/**
+ * @brief ESP32 SPI Slave for the `SPI_ESP_DMA_Master`, using the ESP-IDF driver with queued DMA transactions
+ *
+ * @note Keeps `TALKIE_DMA_SLAVE_SLOTS` fixed `TALKIE_DMA_FRAME_SIZE` full duplex transactions queued at all times,
+ *       so, the Master always finds the Slave armed, even while the loop is busy. Each finished transaction is
+ *       handed by the driver post transaction callback (ISR) to `_receive` through a single producer, single
+ *       consumer ring, without locks, and is queued again right after its frames are taken, so, only the
+ *       transactions still queued cover the time the loop takes to get to it.
+ *       The message to send goes in every transaction queued again until the Master acks its sequence,
+ *       while the messages the Master sends again, with the sequence already taken, are dropped.
+ */
+class SPI_ESP_DMA_Slave : public BroadcastSocket {
+protected:
+
+	const spi_host_device_t _host;
+	bool _initiated = false;
+
+	/**
+	 * @brief A queued DMA transaction and its frames
+	 * @note The frames are members of the singleton, so, in internal and DMA capable memory
+	 */
+	struct Slot {
+		spi_slave_transaction_t transaction;
+		uint8_t tx_frame[TALKIE_DMA_FRAME_SIZE] __attribute__((aligned(4)));
+		uint8_t rx_frame[TALKIE_DMA_FRAME_SIZE] __attribute__((aligned(4)));
+	};
+
+	Slot _slots[TALKIE_DMA_SLAVE_SLOTS];
+
+	// Written only by the post transaction callback (head) and by `_collect` (tail)
+	volatile uint8_t _done_slots[TALKIE_DMA_SLAVE_RING];
+	volatile uint8_t _done_head = 0;
+	volatile uint8_t _done_tail = 0;
+
+	char _sending_buffer[TALKIE_BUFFER_SIZE];
+	uint8_t _sending_length = 0;	// Until acked by the Master
+	uint8_t _tx_seq = 0;		// Sequence of the sending message, never 0 once sending
+	uint8_t _rx_seq = 0;		// Sequence of the last message taken, acked in every frame
+
+	/**
+	 * @brief Received frames waiting for the next `_receive`, given that `_send` may have to collect
+	 *        transactions too while waiting for the sending message to go
+	 */
+	struct Received {
+		uint8_t length;
+		char payload[TALKIE_BUFFER_SIZE];
+	};
+
+	Received _inbox[TALKIE_DMA_SLAVE_SLOTS];
+	uint8_t _inbox_head = 0;
+	uint8_t _inbox_count = 0;
+	uint16_t _errors = 0;		// Frames with a bad magic, length or CRC-16
+
+
+    // Constructor
+    SPI_ESP_DMA_Slave(spi_host_device_t host) : BroadcastSocket(), _host(host) {
+
+			for (uint8_t slot_i = 0; slot_i < TALKIE_DMA_SLAVE_SLOTS; ++slot_i) {
+				memset(&_slots[slot_i].transaction, 0, sizeof(spi_slave_transaction_t));
+				_slots[slot_i].transaction.length = TALKIE_DMA_FRAME_SIZE * 8;	// In bits
+				_slots[slot_i].transaction.tx_buffer = _slots[slot_i].tx_frame;
+				_slots[slot_i].transaction.rx_buffer = _slots[slot_i].rx_frame;
+				_slots[slot_i].transaction.user = this;	// Set ONCE here, for the callback
+			}
+			_max_delay_ms = 0;  // SPI is sequencial, no need to control out of order packages
+	}
+
+
+	// Post transaction callback, runs in the driver ISR on the core that called `begin`
+	static void IRAM_ATTR _transactionDone(spi_slave_transaction_t* transaction) {
+		SPI_ESP_DMA_Slave* self = static_cast<SPI_ESP_DMA_Slave*>(transaction->user);
+		Slot* slot = reinterpret_cast<Slot*>(transaction);	// The transaction is the first member
+		uint8_t done_head = self->_done_head;
+		self->_done_slots[done_head & (TALKIE_DMA_SLAVE_RING - 1)] = (uint8_t)(slot - self->_slots);
+		self->_done_head = done_head + 1;		// Set last, it's what makes the slot available
+	}
+
+
+    /**
+     * @brief Writes a frame, the length up to the payload bytes protected by a CRC-16
+     * @param frame The `TALKIE_DMA_FRAME_SIZE` frame to be written
+     * @param payload The payload bytes, may be nullptr for an empty frame
+     * @param length The amount of payload bytes, up to `TALKIE_BUFFER_SIZE`
+     * @param seq The sequence of the payload
+     * @param ack The sequence of the last payload taken from the other side
+     */
+	static void _writeFrame(uint8_t* frame, const char* payload, uint8_t length, uint8_t seq, uint8_t ack) {
+		frame[0] = TALKIE_DMA_MAGIC;
+		frame[1] = length;
+		frame[2] = seq;
+		frame[3] = ack;
+		uint16_t crc = _crc16(_crc16(_crc16(0xFFFF, length), seq), ack);
+		for (uint8_t i = 0; i < length; i++) {
+			frame[TALKIE_DMA_HEADER_SIZE + i] = (uint8_t)payload[i];
+			crc = _crc16(crc, (uint8_t)payload[i]);
+		}
+		frame[4] = (uint8_t)(crc >> 8);
+		frame[5] = (uint8_t)crc;
+	}
+
+
+    /**
+     * @brief Checks a received frame
+     * @param frame The `TALKIE_DMA_FRAME_SIZE` frame received
+     * @return The payload length, 0 for an empty frame or -1 for a corrupted one
+     */
+	static int _readFrame(const uint8_t* frame) {
+		if (frame[0] != TALKIE_DMA_MAGIC || frame[1] > TALKIE_BUFFER_SIZE) return -1;
+		uint8_t length = frame[1];
+		uint16_t crc = _crc16(_crc16(_crc16(0xFFFF, length), frame[2]), frame[3]);
+		for (uint8_t i = 0; i < length; i++) {
+			crc = _crc16(crc, frame[TALKIE_DMA_HEADER_SIZE + i]);
+		}
+		if (frame[4] != (uint8_t)(crc >> 8) || frame[5] != (uint8_t)crc) return -1;
+		return length;
+	}
+
+
+    /**
+     * @brief Queues a slot again, with the sending message while not acked or an empty frame otherwise
+     * @param slot_i The index of the slot, not queued
+     */
+	void _arm(uint8_t slot_i) {
+		Slot& slot = _slots[slot_i];
+		_writeFrame(slot.tx_frame, _sending_buffer, _sending_length, _tx_seq, _rx_seq);
+		slot.rx_frame[0] = 0;	// Not a frame until clocked in
+		// Never waits, this slot came out of the queue so there is room for it
+		spi_slave_queue_trans(_host, &slot.transaction, 0);
+	}
+
+
+    /**
+     * @brief Takes the finished transactions handed by the callback, moving their received payloads
+	 *        into the inbox and queuing each slot again right away
+     * @return true if at least one transaction was taken
+     */
+	bool _collect() {
+
+		#ifndef SPI_SLAVE_NO_RETURN_RESULT
+		// Older drivers always return the results, so, they are drained given that the callback already has them
+		spi_slave_transaction_t* done;
+		while (spi_slave_get_trans_result(_host, &done, 0) == ESP_OK) {}
+		#endif
+
+		bool collected = false;
+		uint8_t done_tail = _done_tail;
+		while (done_tail != _done_head) {
+			uint8_t slot_i = _done_slots[done_tail & (TALKIE_DMA_SLAVE_RING - 1)];
+			done_tail++;
+			collected = true;
+			Slot& slot = _slots[slot_i];
+
+			int length = slot.transaction.trans_len >= TALKIE_DMA_FRAME_SIZE * 8 ? _readFrame(slot.rx_frame) : -1;
+			if (length < 0) {
+				_errors++;	// Nothing acked, so, both messages go again
+			} else {
+				if (_sending_length && slot.rx_frame[3] == _tx_seq) {
+					_sending_length = 0;	// Acked, frees the buffer for the next one
+				}
+				// The same sequence is the message already taken, sent again while the ack was on its way
+				if (length > 0 && slot.rx_frame[2] != _rx_seq && _inbox_count < TALKIE_DMA_SLAVE_SLOTS) {
+					Received& received = _inbox[(_inbox_head + _inbox_count) % TALKIE_DMA_SLAVE_SLOTS];
+					received.length = (uint8_t)length;
+					memcpy(received.payload, slot.rx_frame + TALKIE_DMA_HEADER_SIZE, length);
+					_inbox_count++;
+					_rx_seq = slot.rx_frame[2];
+				}	// Otherwise, with the inbox full, it isn't acked and so the Master sends it again
+			}
+			_arm(slot_i);
+		}
+		_done_tail = done_tail;
+		return collected;
+	}
+
+
+    void _receive() override {
+
+		if (_initiated) {
+
+			_collect();
+
+			// Delivers the received messages, each one is copied out first because
+			// `_startTransmission` may end up calling `_send`, and so, `_collect`
+			while (_inbox_count) {
+				Received& received = _inbox[_inbox_head];
+				_inbox_head = (_inbox_head + 1) % TALKIE_DMA_SLAVE_SLOTS;
+				_inbox_count--;
+
+				JsonMessage new_message;
+				char* message_buffer = new_message._write_buffer();
+				memcpy(message_buffer, received.payload, received.length);
+				new_message._set_length(received.length);
+
+				#ifdef BROADCAST_SPI_DEBUG
+				Serial.print(F("\treceive1: Received message: "));
+				Serial.write(message_buffer, received.length);
+				Serial.println();
+				#endif
+
+				if (new_message._validate_json()) {
+					new_message._process_checksum();	// Has to validate and process the checksum
+					_startTransmission(new_message);
+				}
+			}
+		}
+    }
+
+
+    // Socket processing is always Half-Duplex because there is just one buffer to send
+    bool _send(const JsonMessage& json_message) override {
+
+		if (_initiated) {
+
+			const uint16_t start_waiting = (uint16_t)millis();
+			while (_sending_length) {
+				_collect();	// Keeps the transactions going while the previous message waits for the Master
+				if ((uint16_t)((uint16_t)millis() - start_waiting) > TALKIE_DMA_SLAVE_WAIT_MS) {
+
+					#ifdef BROADCAST_SPI_DEBUG
+					Serial.println(F("\t_send: NOT available sending buffer"));
+					#endif
+
+					return false;
+				}
+			}
+			_sending_length = (uint8_t)json_message.serialize_json(_sending_buffer, TALKIE_BUFFER_SIZE);
+			if (!++_tx_seq) _tx_seq = 1;	// 0 is never a message sequence
+
+			#ifdef BROADCAST_SPI_DEBUG
+			Serial.print(F("\t\t\t\t\tsend1: Sent message: "));
+			Serial.write(_sending_buffer, _sending_length);
+			Serial.println();
+			#endif
+
+			return _sending_length > 0;
+		}
+        return false;
+    }
+
+
+public:
+
+    // Move ONLY the singleton instance method to subclass
+    static SPI_ESP_DMA_Slave& instance(spi_host_device_t host = HSPI_HOST) {
+        static SPI_ESP_DMA_Slave instance(host);
+
+        return instance;
+    }
+
+    const char* class_name() const override { return "SPI_ESP_DMA_Slave"; }
+
+
+    /**
+     * @brief Gets the frames received with a bad magic, length or CRC-16, or cut short by the Master
+     * @return The amount of corrupted frames
+     */
+	uint16_t get_errors_count() const { return _errors; }
+
+
+    /**
+     * @brief Initializes the SPI Slave with DMA and queues all the transactions
+     * @param sclk_pin The clock pin
+     * @param miso_pin The MISO pin
+     * @param mosi_pin The MOSI pin
+     * @param ss_pin The SS pin driven by the Master
+     * @return true if the Slave was set up
+     *
+     * @note Call it from the loop core (like from `setup`), where the callback ISR then runs
+     */
+	bool begin(int sclk_pin, int miso_pin, int mosi_pin, int ss_pin) {
+
+		spi_bus_config_t bus_config = {};
+		bus_config.mosi_io_num = mosi_pin;
+		bus_config.miso_io_num = miso_pin;
+		bus_config.sclk_io_num = sclk_pin;
+		bus_config.quadwp_io_num = -1;
+		bus_config.quadhd_io_num = -1;
+		bus_config.max_transfer_sz = TALKIE_DMA_FRAME_SIZE;
+
+		spi_slave_interface_config_t slave_config = {};
+		slave_config.mode = 0;
+		slave_config.spics_io_num = ss_pin;
+		slave_config.queue_size = TALKIE_DMA_SLAVE_SLOTS;
+		slave_config.post_trans_cb = _transactionDone;
+		#ifdef SPI_SLAVE_NO_RETURN_RESULT
+		slave_config.flags = SPI_SLAVE_NO_RETURN_RESULT;	// The callback is the only handoff
+		#endif
+
+		_initiated = spi_slave_initialize(_host, &bus_config, &slave_config, SPI_DMA_CH_AUTO) == ESP_OK;
+		if (_initiated) {
+			// A random start, so that after a reset the first message isn't taken as one sent again
+			_tx_seq = (uint8_t)random(1, 256);
+			for (uint8_t slot_i = 0; slot_i < TALKIE_DMA_SLAVE_SLOTS; ++slot_i) {
+				_arm(slot_i);
+			}
+		}
+
+		#ifdef BROADCAST_SPI_DEBUG
+		Serial.print(class_name());
+		Serial.println(_initiated ? F(": Socket initiated!") : F(": Socket NOT initiated!"));
+		#endif
+
+		return _initiated;
+	}
+};
+
+
+#endif // SPI_ESP_DMA_SLAVE_HPP
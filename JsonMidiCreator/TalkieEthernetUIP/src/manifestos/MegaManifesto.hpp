@@ -19,6 +19,20 @@ https://github.com/ruiseixasm/JsonTalkie
 // #define MEGA_MANIFESTO_DEBUG
 
 
+// The Actions are kept in flash (PROGMEM), sparing their RAM on AVR boards
+const char mega_on_name[] PROGMEM = "on";
+const char mega_on_desc[] PROGMEM = "Turns led ON";
+const char mega_off_name[] PROGMEM = "off";
+const char mega_off_desc[] PROGMEM = "Turns led OFF";
+const char mega_bpm_10_name[] PROGMEM = "bpm_10";
+const char mega_bpm_10_desc[] PROGMEM = "Sets the Tempo in BPM x 10";
+const Action mega_calls[3] PROGMEM = {
+	{mega_on_name, mega_on_desc},
+	{mega_off_name, mega_off_desc},
+	{mega_bpm_10_name, mega_bpm_10_desc}
+};
+
+
 class MegaManifesto : public TalkerManifesto {
 public:
 
@@ -33,26 +47,20 @@ protected:
     uint16_t _bpm_10 = 1200;
     uint16_t _total_calls = 0;
 
-
-    Action calls[3] = {
-		{"on", "Turns led ON"},
-		{"off", "Turns led OFF"},
-		{"bpm_10", "Sets the Tempo in BPM x 10"}
-    };
-    
 public:
     
-    const Action* _getActionsArray() const override { return calls; }
+    const Action* _getActionsArray() const override { return mega_calls; }
 
     // Size methods
-    uint8_t _actionsCount() const override { return sizeof(calls)/sizeof(Action); }
+    uint8_t _actionsCount() const override { return sizeof(mega_calls)/sizeof(Action); }
+    bool _actionsInFlash() const override { return true; }
 
 
     // Index-based operations (simplified examples)
     bool _actionByIndex(uint8_t index, JsonTalker& talker, JsonMessage& json_message, TalkerMatch talker_match) override {
         (void)talker;		// Silence unused parameter warning
 		
-		if (index >= sizeof(calls)/sizeof(Action)) return false;
+		if (index >= sizeof(mega_calls)/sizeof(Action)) return false;
 		
 		// Actual implementation would do something based on index
 		switch(index) {
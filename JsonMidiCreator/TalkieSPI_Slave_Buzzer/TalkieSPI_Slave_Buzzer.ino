@@ -22,9 +22,9 @@ https://github.com/ruiseixasm/JsonTalkie
 
 
 const char talker_name[] = "buzzer";
-const char talker_desc[] = "I'm a buzzer that buzzes";
+const char talker_desc[] PROGMEM = "I'm a buzzer that buzzes";
 BuzzerManifesto talker_manifesto;
-JsonTalker talker = JsonTalker(talker_name, talker_desc, &talker_manifesto);
+JsonTalker talker = JsonTalker(talker_name, FPSTR(talker_desc), &talker_manifesto);
 
 // Singleton requires the & (to get a reference variable)
 auto& spi_socket = SPI_Arduino_Slave::instance();
@@ -46,8 +46,6 @@ https://github.com/ruiseixasm/JsonTalkie
 // 		d (description) → 64 bytes (63 + '\0')
 
 
-// #define MESSAGE_DEBUG_TIMING
-
 #define TALKIE_BUFFER_SIZE 128	    ///< Default buffer size for JSON message
 #define TALKIE_NAME_LEN 16			///< Default maximum length for name fields
 #define TALKIE_MAX_LEN 64			///< Default maximum length for string fields
@@ -83,11 +81,6 @@ public:
 		MessageValue message_value;
 	};
 
-
-	#ifdef MESSAGE_DEBUG_TIMING
-	unsigned long _reference_time = millis();
-	#endif
-
 private:
 
 	char _json_payload[TALKIE_BUFFER_SIZE];			///< Internal JSON buffer
@@ -278,6 +271,30 @@ private:
 	}
 
 
+	/**
+     * @brief Hashes the string value of a key directly from the payload
+     * @param key Single character key
+     * @param colon_position Optional hint for colon position
+     * @return Same hash as `_name_hash` for the value, or 0 if not a string
+     *
+     * @note Avoids copying the string into the temporary buffer
+     */
+	uint16_t _get_value_hash(char key, size_t colon_position = 4) const {
+		size_t json_i = _get_value_position(key, colon_position);
+		if (json_i && _json_payload[json_i++] == '"') {
+			uint16_t hash = 5381;
+			for (size_t char_j = 0; json_i < _json_length && _json_payload[json_i] != '"'; ++json_i) {
+				if (++char_j == TALKIE_NAME_LEN) return 0;	// Too long to be a name
+				hash = (hash << 5) + hash + static_cast<uint8_t>(_json_payload[json_i]);
+			}
+			if (json_i < _json_length) {
+				return hash ? hash : 1;
+			}
+		}
+		return 0;
+	}
+
+
 	/**
      * @brief Extract numeric value for a key
      * @param key Single character key
@@ -413,17 +430,24 @@ private:
 	}
 
 
+	// Reads a string char from RAM or from flash
+	static char _string_char(const char* in_string, size_t char_j, bool in_flash) {
+		return in_flash ? static_cast<char>(pgm_read_byte(in_string + char_j)) : in_string[char_j];
+	}
+
+
     /**
      * @brief Set string value for a key
      * @param key Key to set
      * @param in_string String value (null-terminated)
      * @param colon_position Optional hint for colon position
+     * @param in_flash If the string is stored in flash (PROGMEM), like the `F()` ones
      * @return true if successful, false if buffer too small or string empty
      */
-	bool _set_string(char key, const char* in_string, size_t colon_position = 4) {
+	bool _set_string(char key, const char* in_string, size_t colon_position = 4, bool in_flash = false) {
 		if (in_string) {
 			size_t length = 0;
-			for (size_t char_j = 0; in_string[char_j] != '\0' && char_j < TALKIE_BUFFER_SIZE; char_j++) {
+			for (size_t char_j = 0; _string_char(in_string, char_j, in_flash) != '\0' && char_j < TALKIE_BUFFER_SIZE; char_j++) {
 				length++;
 			}
 			// It can have empty strings too, so, a length can be 0!
@@ -457,7 +481,7 @@ private:
 			_json_payload[setting_position++] = '"';
 			// To be added, it has to be from right to left
 			for (size_t char_j = 0; char_j < length; char_j++) {
-				_json_payload[setting_position++] = in_string[char_j];
+				_json_payload[setting_position++] = _string_char(in_string, char_j, in_flash);
 			}
 			// Adds the second char '"'
 			_json_payload[setting_position++] = '"';
@@ -730,6 +754,15 @@ public:
 	}
 
 
+    /**
+     * @brief Gets the checksum of the message content as it is, without any checksum field
+     * @return The checksum of the content
+     */
+	uint16_t _get_checksum() const {
+		return _generateChecksum();
+	}
+
+
     /**
      * @brief Generates a new message checksum and inserts it in the message
      * @return true if it had space to insert the checksum field
@@ -1076,6 +1109,42 @@ public:
     }
 
 
+    /**
+     * @brief Hashes a name into a compact 16 bits key (djb2)
+     * @param name Null terminated name
+     * @return Name hash, never 0 so that 0 can be used as an empty slot
+     *
+     * @note Hashes may collide, so, a match by hash is a hint and not a proof
+     */
+	static uint16_t _name_hash(const char* name) {
+		uint16_t hash = 5381;
+		if (name) {
+			while (*name) {
+				hash = (hash << 5) + hash + static_cast<uint8_t>(*name++);
+			}
+		}
+		return hash ? hash : 1;
+	}
+
+
+    /**
+     * @brief Get sender name hash
+     * @return Hash of the 'f' field name, or 0 if not found
+     */
+	uint16_t get_from_hash() const {
+		return _get_value_hash('f');
+	}
+
+
+    /**
+     * @brief Get target name hash
+     * @return Hash of the 't' field name, or 0 if not a name
+     */
+	uint16_t get_to_hash() const {
+		return _get_value_hash('t');
+	}
+
+
     /**
      * @brief Get target type
      * @return ValueType of 't' field
@@ -1402,6 +1471,16 @@ public:
 	}
 
 
+    /**
+     * @brief Set action name stored in flash (PROGMEM)
+     * @param name Action name string in flash
+     * @return true if successful
+     */
+	bool set_action_name(const __FlashStringHelper* name) {
+		return _set_string('a', reinterpret_cast<const char*>(name), 4, true);
+	}
+
+
     /**
      * @brief Set action index
      * @param index Action index
@@ -1480,6 +1559,20 @@ public:
 	}
 
 
+    /**
+     * @brief Set nth value as string stored in flash (PROGMEM)
+     * @param nth Index 0-9
+     * @param in_string String value in flash, like `F("text")`
+     * @return true if successful
+     */
+	bool set_nth_value_string(uint8_t nth, const __FlashStringHelper* in_string) {
+		if (nth < 10) {
+			return _set_string('0' + nth, reinterpret_cast<const char*>(in_string), 4, true);
+		}
+		return false;
+	}
+
+
     /**
      * @brief Set as a No Reply for `call` messages
 	 * 
@@ -21,6 +21,21 @@ https://github.com/ruiseixasm/JsonTalkie
 #define BUZZ_PIN 2	// External BUZZER pin
 
 
+// The Actions are kept in flash (PROGMEM), sparing their RAM on AVR boards
+const char buzzer_buzz_name[] PROGMEM = "buzz";
+const char buzzer_buzz_desc[] PROGMEM = "Buzz for a while";
+const char buzzer_ms_name[] PROGMEM = "ms";
+const char buzzer_ms_desc[] PROGMEM = "Gets and sets the buzzing duration";
+const char buzzer_ring_name[] PROGMEM = "ring";
+const char buzzer_ring_desc[] PROGMEM = "Buzz and reply once done";
+// ALWAYS MAKE SURE THE DIMENSIONS OF THE ARRAYS BELOW ARE THE CORRECT!
+const Action buzzer_calls[3] PROGMEM = {
+	{buzzer_buzz_name, buzzer_buzz_desc},
+	{buzzer_ms_name, buzzer_ms_desc},
+	{buzzer_ring_name, buzzer_ring_desc}
+};
+
+
 class BuzzerManifesto : public TalkerManifesto {
 public:
 
@@ -33,19 +48,13 @@ protected:
     uint16_t _buzz_duration_ms = 100;
 	uint16_t _buzz_start = 0;
 
-	// ALWAYS MAKE SURE THE DIMENSIONS OF THE ARRAYS BELOW ARE THE CORRECT!
-
-    Action calls[2] = {
-		{"buzz", "Buzz for a while"},
-		{"ms", "Gets and sets the buzzing duration"}
-    };
-    
 public:
 
-    const Action* _getActionsArray() const override { return calls; }
+    const Action* _getActionsArray() const override { return buzzer_calls; }
 
     // Size methods
-    uint8_t _actionsCount() const override { return sizeof(calls)/sizeof(Action); }
+    uint8_t _actionsCount() const override { return sizeof(buzzer_calls)/sizeof(Action); }
+    bool _actionsInFlash() const override { return true; }
 
 
 	void _loop(JsonTalker& talker) override {
@@ -58,6 +67,31 @@ public:
 	}
 
     
+    // The ring is a slow Action, pending until the buzzing ends, so, it doesn't block the loop
+    ActionState _startAction(uint8_t index, JsonTalker& talker, JsonMessage& json_message, TalkerMatch talker_match) override {
+		if (index == 2) {
+			#ifdef BUZZ_PIN
+			digitalWrite(BUZZ_PIN, HIGH);
+			#endif
+			_buzz_start = (uint16_t)millis();
+			return ActionState::TALKIE_AS_PENDING;
+		}
+		return TalkerManifesto::_startAction(index, talker, json_message, talker_match);
+	}
+
+
+    ActionState _pollAction(uint8_t index, JsonTalker& talker, JsonMessage& json_message) override {
+        (void)talker;		// Silence unused parameter warning
+		if (index != 2) return ActionState::TALKIE_AS_NEGATIVE;
+		if ((uint16_t)millis() - _buzz_start <= _buzz_duration_ms) return ActionState::TALKIE_AS_PENDING;
+		#ifdef BUZZ_PIN
+		digitalWrite(BUZZ_PIN, LOW);
+		#endif
+		json_message.set_nth_value_number(0, _buzz_duration_ms);
+		return ActionState::TALKIE_AS_ROGER;
+	}
+
+    
     // Index-based operations (simplified examples)
     bool _actionByIndex(uint8_t index, JsonTalker& talker, JsonMessage& json_message, TalkerMatch talker_match) override {
         (void)talker;		// Silence unused parameter warning
@@ -33,9 +33,9 @@ https://github.com/ruiseixasm/JsonTalkie
 
 
 const char talker_name[] = "green";
-const char talker_desc[] = "I'm a green talker";
+const char talker_desc[] PROGMEM = "I'm a green talker";
 GreenManifesto green_manifesto;
-JsonTalker talker = JsonTalker(talker_name, talker_desc, &green_manifesto);
+JsonTalker talker = JsonTalker(talker_name, FPSTR(talker_desc), &green_manifesto);
 
 // Singleton requires the & (to get a reference variable)
 auto& spi_socket = SPI_Arduino_Slave::instance();
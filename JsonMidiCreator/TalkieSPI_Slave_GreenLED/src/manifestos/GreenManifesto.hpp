@@ -19,6 +19,22 @@ https://github.com/ruiseixasm/JsonTalkie
 // #define GREEN_TALKER_DEBUG
 
 
+// The Actions are kept in flash (PROGMEM), sparing their RAM on AVR boards
+const char green_on_name[] PROGMEM = "on";
+const char green_on_desc[] PROGMEM = "Turns led ON";
+const char green_off_name[] PROGMEM = "off";
+const char green_off_desc[] PROGMEM = "Turns led OFF";
+const char green_bpm_10_name[] PROGMEM = "bpm_10";
+const char green_bpm_10_desc[] PROGMEM = "Sets the Tempo in BPM x 10";
+const char green_bpm_10_desc_2[] PROGMEM = "Gets the Tempo in BPM x 10";
+const Action green_calls[4] PROGMEM = {
+	{green_on_name, green_on_desc},
+	{green_off_name, green_off_desc},
+	{green_bpm_10_name, green_bpm_10_desc},
+	{green_bpm_10_name, green_bpm_10_desc_2}
+};
+
+
 class GreenManifesto : public TalkerManifesto {
 public:
 
@@ -32,27 +48,20 @@ protected:
     uint16_t _bpm_10 = 1200;
     uint16_t _total_calls = 0;
 
-
-    Action calls[4] = {
-		{"on", "Turns led ON"},
-		{"off", "Turns led OFF"},
-		{"bpm_10", "Sets the Tempo in BPM x 10"},
-		{"bpm_10", "Gets the Tempo in BPM x 10"}
-    };
-    
 public:
     
-    const Action* _getActionsArray() const override { return calls; }
+    const Action* _getActionsArray() const override { return green_calls; }
 
     // Size methods
-    uint8_t _actionsCount() const override { return sizeof(calls)/sizeof(Action); }
+    uint8_t _actionsCount() const override { return sizeof(green_calls)/sizeof(Action); }
+    bool _actionsInFlash() const override { return true; }
 
 
     // Index-based operations (simplified examples)
     bool _actionByIndex(uint8_t index, JsonTalker& talker, JsonMessage& json_message, TalkerMatch talker_match) override {
         (void)talker;		// Silence unused parameter warning
 		
-		if (index >= sizeof(calls)/sizeof(Action)) return false;
+		if (index >= sizeof(green_calls)/sizeof(Action)) return false;
 		
 		// Actual implementation would do something based on index
 		switch(index) {
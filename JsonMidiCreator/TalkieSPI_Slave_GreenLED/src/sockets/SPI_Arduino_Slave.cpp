@@ -23,14 +23,46 @@ volatile uint8_t SPI_Arduino_Slave::_received_length = 0;
 volatile uint8_t SPI_Arduino_Slave::_sending_index = 0;
 volatile uint8_t SPI_Arduino_Slave::_validation_index = 0;
 volatile uint8_t SPI_Arduino_Slave::_sending_length = 0;
-volatile SPI_Arduino_Slave::StatusByte SPI_Arduino_Slave::_transmission_mode 
+volatile SPI_Arduino_Slave::IsrState SPI_Arduino_Slave::_isr_state
+									= SPI_Arduino_Slave::IsrState::TALKIE_ISR_IDLE;
+volatile uint8_t SPI_Arduino_Slave::_block_length = 0;
+volatile uint8_t SPI_Arduino_Slave::_block_index = 0;
+volatile uint16_t SPI_Arduino_Slave::_block_crc = 0xFFFF;
+volatile uint16_t SPI_Arduino_Slave::_sending_crc = 0xFFFF;
+volatile uint8_t SPI_Arduino_Slave::_exchange_length = 0;
+volatile uint8_t SPI_Arduino_Slave::_exchange_slots = 0;
+volatile SPI_Arduino_Slave::StatusByte SPI_Arduino_Slave::_broadcast_status
 									= SPI_Arduino_Slave::StatusByte::TALKIE_SB_NONE;
+volatile bool SPI_Arduino_Slave::_broadcast = false;
+
+#ifdef TALKIE_SPI_PROFILE
+uint16_t SPI_Arduino_Slave::_isr_worst_cycles[SPI_Arduino_Slave::TALKIE_ISR_PATHS];
+uint16_t SPI_Arduino_Slave::_isr_calls[SPI_Arduino_Slave::TALKIE_ISR_PATHS];
+uint32_t SPI_Arduino_Slave::_isr_total_cycles[SPI_Arduino_Slave::TALKIE_ISR_PATHS];
+volatile uint16_t SPI_Arduino_Slave::_isr_worst = 0;
+volatile uint8_t SPI_Arduino_Slave::_isr_worst_path = 0;
+#endif
 
 
 // Define ISR at GLOBAL SCOPE (outside the class)
 ISR(SPI_STC_vect) {
     // You need a way to call your class method from here
     // Possibly using a static method or singleton pattern
+	#ifdef TALKIE_SPI_PROFILE
+	uint8_t path = SPI_Arduino_Slave::_profilePath();
+	uint16_t start_cycles = TCNT1;
+    SPI_Arduino_Slave::handleSPI_Interrupt();
+	uint16_t cycles = TCNT1 - start_cycles;
+	SPI_Arduino_Slave::_profileISR(path, cycles);
+	#else
     SPI_Arduino_Slave::handleSPI_Interrupt();
+	#endif
+}
+
+#ifdef TALKIE_SPI_SS_PCINT
+// The SS pin (PB2) is in the PCINT0 group, so, the sketch can't use PCINT0 (like SoftwareSerial does)
+ISR(PCINT0_vect) {
+    SPI_Arduino_Slave::handleSS_Interrupt();
 }
+#endif
 
@@ -19,9 +19,15 @@ https://github.com/ruiseixasm/JsonTalkie
 #include "../BroadcastSocket.h"
 
 
+#define TALKIE_SPI_VERSION 4	///< Answered to a second ACK, Slaves without it answer ACK again (version 1)
+#define TALKIE_SPI_NO_BROADCAST_VERSION 3	///< Answered instead while the broadcast is off, given that MISO is always driven
+
+
 // #define BROADCAST_SPI_DEBUG
 // #define BROADCAST_SPI_DEBUG_1
 // #define BROADCAST_SPI_DEBUG_2
+// #define TALKIE_SPI_PROFILE	///< Counts the cycles of each ISR path with Timer1 (no PWM on pins 9 and 10 then)
+// #define TALKIE_SPI_SS_PCINT	///< Ends the frames on the rising SS with the PCINT0 interrupt, otherwise the loop does it
 
 
 class SPI_Arduino_Slave : public BroadcastSocket {
@@ -30,6 +36,9 @@ public:
     const char* class_name() const override { return "SPI_Arduino_Slave"; }
 
     enum StatusByte : uint8_t {
+		TALKIE_SB_BROADCAST_STATUS	= 0xED,	// Asks how the last broadcast block frame went (version 4)
+		TALKIE_SB_BROADCAST_BLOCK	= 0xEE,	// Block frame written to all Slaves at once, MISO kept released (version 4)
+		TALKIE_SB_EXCHANGE_BLOCK	= 0xEF,	// Sends and receives block frames at once, full duplex (version 3)
         TALKIE_SB_ACK		= 0xF0, // Acknowledge
         TALKIE_SB_NACK		= 0xF1, // Not acknowledged
         TALKIE_SB_READY   	= 0xF2, // Slave is ready
@@ -43,10 +52,41 @@ public:
 		TALKIE_SB_DONE		= 0xFA,	// Marks the action as DONE
         TALKIE_SB_ERROR   	= 0xFB, // Error frame
         TALKIE_SB_FULL    	= 0xFC, // Signals the buffer as full
+		TALKIE_SB_RECEIVE_BLOCK	= 0xFD,	// Asks to receive a length, raw bytes and CRC-16 frame (version 2)
+		TALKIE_SB_SEND_BLOCK	= 0xFE,	// Asks to send a length, raw bytes and CRC-16 frame (version 2)
         
         TALKIE_SB_VOID    	= 0xFF  // MISO floating (0xFF) → no slave responding
     };
 
+	/**
+	 * @brief What the ISR does with the next byte, dense so that a single switch dispatches it by a jump table
+	 * @note Only the states up to `TALKIE_ISR_VERSION` take Status Bytes, the ones from it on end with the
+	 *       rising SS and the broadcast ones, the last, keep MISO released
+	 */
+	enum IsrState : uint8_t {
+		TALKIE_ISR_IDLE,				// Status Bytes only
+		TALKIE_ISR_RECEIVE,				// Chars in, echoed one behind (version 1)
+		TALKIE_ISR_SEND,				// Chars out, checked two behind (version 1)
+		TALKIE_ISR_VERSION,				// After an ACK, a second ACK gets the version
+		TALKIE_ISR_RECEIVE_LENGTH,		// Version 2 block frames
+		TALKIE_ISR_RECEIVE_FRAME,
+		TALKIE_ISR_SEND_FRAME,
+		TALKIE_ISR_SEND_CRC,
+		TALKIE_ISR_SEND_END,
+		TALKIE_ISR_EXCHANGE_LENGTH,		// Version 3 exchange
+		TALKIE_ISR_EXCHANGE_FRAME,
+		TALKIE_ISR_EXCHANGE_VERDICT,
+		TALKIE_ISR_BROADCAST_LENGTH,	// Version 4 broadcast
+		TALKIE_ISR_BROADCAST_FRAME,
+		TALKIE_ISR_BROADCAST_IGNORE,
+		TALKIE_ISR_STATES
+	};
+
+	#ifdef TALKIE_SPI_PROFILE
+	// The states plus the Status Bytes from `TALKIE_SB_BROADCAST_STATUS` taken by them
+	static const uint8_t TALKIE_ISR_PATHS = TALKIE_ISR_STATES + (0x100 - TALKIE_SB_BROADCAST_STATUS);
+	#endif
+
 
 protected:
 
@@ -58,7 +98,36 @@ protected:
     volatile static uint8_t _sending_index;
     volatile static uint8_t _validation_index;
 	volatile static uint8_t _sending_length;
-    volatile static StatusByte _transmission_mode;
+    volatile static IsrState _isr_state;
+
+	// Version 2 block frames
+    volatile static uint8_t _block_length;
+    volatile static uint8_t _block_index;
+    volatile static uint16_t _block_crc;
+    volatile static uint16_t _sending_crc;
+
+	// Version 3 exchange, the sent length is kept apart because `_send` may set a new one meanwhile
+    volatile static uint8_t _exchange_length;
+    volatile static uint8_t _exchange_slots;	// Bytes after the length, the longest frame plus the length echo
+
+	// Version 4 broadcast, ACK, ERROR or BUSY until asked by the Master
+    volatile static StatusByte _broadcast_status;
+	// With the broadcast on, MISO is released between transactions and only driven after a first byte other than
+	// `TALKIE_SB_BROADCAST_BLOCK`, so that the selected Slaves never fight over it
+    volatile static bool _broadcast;
+
+	#ifdef TALKIE_SPI_PROFILE
+	static uint16_t _isr_worst_cycles[TALKIE_ISR_PATHS];
+	static uint16_t _isr_calls[TALKIE_ISR_PATHS];
+	static uint32_t _isr_total_cycles[TALKIE_ISR_PATHS];
+	volatile static uint16_t _isr_worst;
+	volatile static uint8_t _isr_worst_path;
+	uint16_t _logged_worst = 0;
+	#endif
+
+	// Optional open-drain line pulled LOW while there is something to send
+	int _attention_pin = -1;
+	bool _attention_asserted = false;
 
 
     // Needed for the compiler, the base class is the one being called though
@@ -81,6 +150,18 @@ protected:
 			SPCR &= ~_BV(CPOL);  // Clock polarity 0
 			SPCR &= ~_BV(CPHA);  // Clock phase 0 (MODE0)
 
+			#ifdef TALKIE_SPI_SS_PCINT
+			// The rising SS ends any block frame, so, a Master giving up on it never desyncs the Slave
+			PCICR |= _BV(PCIE0);
+			PCMSK0 |= _BV(PCINT2);	// SS (pin 10, PB2)
+			#endif
+
+			#ifdef TALKIE_SPI_PROFILE
+			// Timer1 free running at the CPU clock, so, one count per cycle
+			TCCR1A = 0;
+			TCCR1B = _BV(CS10);
+			#endif
+
             _max_delay_ms = 0;  // SPI is sequencial, no need to control out of order packages
             // // Initialize devices control object (optional initial setup)
             // devices_ss_pins["initialized"] = true;
@@ -89,6 +170,37 @@ protected:
 	
     void _receive() override {
 
+		#ifdef TALKIE_SPI_PROFILE
+		// Logged here and not in the ISR, where a Serial print would be the worst case itself
+		if (_isr_worst > _logged_worst) {
+			noInterrupts();
+			uint16_t worst = _isr_worst;
+			uint8_t worst_path = _isr_worst_path;
+			interrupts();
+			_logged_worst = worst;
+			Serial.print(F("ISR worst path "));
+			Serial.print(worst_path);
+			Serial.print(F(": "));
+			Serial.print(worst);
+			Serial.println(F(" cycles"));
+		}
+		#endif
+
+		#ifndef TALKIE_SPI_SS_PCINT
+		// Without the PCINT0 interrupt, the frames left unfinished by a rising SS are ended here instead
+		if (_isr_state >= TALKIE_ISR_VERSION) {
+			noInterrupts();
+			handleSS_Interrupt();	// Does nothing while SS is still LOW
+			interrupts();
+		}
+		#endif
+
+		// Releases the attention line as soon as the Master took the message
+		if (_attention_asserted && !_sending_length) {
+			pinMode(_attention_pin, INPUT);
+			_attention_asserted = false;
+		}
+
 		if (_received_length) {
 
 			JsonMessage new_message;
@@ -138,7 +250,19 @@ protected:
 				return false;
 			}
 		}
-		_sending_length = json_message.serialize_json(_sending_buffer, TALKIE_BUFFER_SIZE);
+		uint8_t sending_length = json_message.serialize_json(_sending_buffer, TALKIE_BUFFER_SIZE);
+		uint16_t sending_crc = 0xFFFF;
+		for (uint8_t char_j = 0; char_j < sending_length; char_j++) {
+			sending_crc = _crc16(sending_crc, _sending_buffer[char_j]);
+		}
+		_sending_crc = sending_crc;
+		_sending_length = sending_length;	// Set last, it's what makes the message available
+		if (_attention_pin >= 0) {
+			// Open-drain, LOW when driven and released as an input
+			digitalWrite(_attention_pin, LOW);
+			pinMode(_attention_pin, OUTPUT);
+			_attention_asserted = true;
+		}
 			
         return true;
     }
@@ -155,6 +279,118 @@ public:
 
 	// Specific methods associated to Arduino SPI as Slave
 
+
+    /**
+     * @brief Sets the open-drain attention line pulled LOW while there is something to send,
+	 *        so that the Master only polls this Slave when needed
+     * @param attention_pin The attention pin, or -1 for none
+     * 
+     * @note The line is shared with the Master (and other Slaves) so it's never driven HIGH
+     */
+	void set_attention_pin(int attention_pin) {
+		if (_attention_pin >= 0) {
+			pinMode(_attention_pin, INPUT);
+		}
+		_attention_pin = attention_pin;
+		_attention_asserted = false;
+		if (_attention_pin >= 0) {
+			pinMode(_attention_pin, INPUT);
+		}
+	}
+
+
+	#ifdef TALKIE_SPI_SS_PCINT
+
+    /**
+     * @brief Turns on or off the version 4 broadcast, the block frames written by the Master to all
+	 *        Slaves at once, answering version 3 to the Master while off (default)
+     * @param broadcast true to have MISO released between transactions, as the broadcast requires
+     * 
+     * @note Only the PCINT0 interrupt releases MISO soon enough after a transaction, and a series resistor
+	 *       (1k) on each Slave MISO is required, see the README
+     */
+	void set_broadcast(bool broadcast) {
+		noInterrupts();
+		_broadcast = broadcast;
+		if (!broadcast) {
+			DDRB |= _BV(DDB4);
+		} else if (PINB & _BV(PINB2)) {	// Otherwise released once SS rises
+			DDRB &= ~_BV(DDB4);
+		}
+		interrupts();
+	}
+
+	#endif
+
+
+	#ifdef TALKIE_SPI_PROFILE
+
+    /**
+     * @brief Gets the cycles taken by an ISR path, from reading `SPDR` until returning, so,
+	 *        without the vector jump and the registers pushed and popped around it
+     * @param path Below `TALKIE_ISR_STATES` the byte taken as data by that state, otherwise
+	 *        the Status Byte `TALKIE_SB_BROADCAST_STATUS + path - TALKIE_ISR_STATES`
+     * @param worst_cycles The longest run
+     * @param calls The runs so far (saturated)
+     * @param total_cycles All runs added, for the average
+     * @return false if there is no such path
+     */
+	bool get_isr_profile(uint8_t path, uint16_t& worst_cycles, uint16_t& calls, uint32_t& total_cycles) const {
+		if (path >= TALKIE_ISR_PATHS) return false;
+		noInterrupts();
+		worst_cycles = _isr_worst_cycles[path];
+		calls = _isr_calls[path];
+		total_cycles = _isr_total_cycles[path];
+		interrupts();
+		return true;
+	}
+
+
+    /**
+     * @brief Clears all the ISR paths counts, like for a new profile run
+     */
+	void reset_isr_profile() {
+		noInterrupts();
+		for (uint8_t path_i = 0; path_i < TALKIE_ISR_PATHS; path_i++) {
+			_isr_worst_cycles[path_i] = 0;
+			_isr_calls[path_i] = 0;
+			_isr_total_cycles[path_i] = 0;
+		}
+		_isr_worst = 0;
+		_isr_worst_path = 0;
+		_logged_worst = 0;
+		interrupts();
+	}
+
+
+    // The path the byte in `SPDR` is about to take, read by the ISR before the Timer1 capture
+	static uint8_t _profilePath() {
+		uint8_t c = SPDR;
+		uint8_t isr_state = _isr_state;
+		if (isr_state <= TALKIE_ISR_VERSION && c >= TALKIE_SB_BROADCAST_STATUS) {
+			return TALKIE_ISR_STATES + (uint8_t)(c - TALKIE_SB_BROADCAST_STATUS);
+		}
+		return isr_state;
+	}
+
+
+	static void _profileISR(uint8_t path, uint16_t cycles) {
+		if (_isr_calls[path] < 0xFFFF) {	// Keeps the average of the first ones
+			_isr_calls[path]++;
+			_isr_total_cycles[path] += cycles;
+		}
+		if (cycles > _isr_worst_cycles[path]) {
+			_isr_worst_cycles[path] = cycles;
+			if (cycles > _isr_worst) {
+				_isr_worst = cycles;
+				_isr_worst_path = path;
+			}
+		}
+	}
+
+	#endif
+
+
     // Actual interrupt handler
     static void handleSPI_Interrupt() {
 
@@ -175,141 +411,343 @@ public:
 
         uint8_t c = SPDR;    // Avoid using 'char' while using values above 127
 
-        if (c < 128) {  // Only ASCII chars shall be transmitted as data
-
-            // switch O(1) is more efficient than an if-else O(n) sequence because the compiler uses a jump table
+		// MISO is only released by the broadcast, so, this costs a single bit test to all the other bytes
+		if (!(DDRB & _BV(DDB4)) && _isr_state < TALKIE_ISR_BROADCAST_LENGTH && c != TALKIE_SB_BROADCAST_BLOCK) {
+			DDRB |= _BV(DDB4);	// The first byte isn't a broadcast, so, this Slave is the only one selected
+		}
 
-            switch (_transmission_mode) {
-                case TALKIE_SB_RECEIVE:
-                    if (_receiving_index < TALKIE_BUFFER_SIZE) {
-                        _received_buffer[_receiving_index] = c;
-						if (_receiving_index > 0) {
-							SPDR = _received_buffer[_receiving_index - 1];	// Char sent with an offset to guarantee matching
+		// A single dispatch on the state, the block frames take any byte as data, while the other states
+		// only take ASCII chars as data and leave the rest to the Status Bytes switch bellow
+		switch (_isr_state) {
+			case TALKIE_ISR_RECEIVE:
+				if (c < 128) {
+					uint8_t receiving_index = _receiving_index;
+					if (receiving_index < TALKIE_BUFFER_SIZE) {
+						_received_buffer[receiving_index] = c;
+						_receiving_index = receiving_index + 1;
+						if (receiving_index > 0) {
+							SPDR = _received_buffer[receiving_index - 1];	// Char sent with an offset to guarantee matching
 						}
-						_receiving_index++;
-                    } else {
-						_transmission_mode = TALKIE_SB_NONE;
-                        SPDR = TALKIE_SB_FULL;
+					} else {
+						_isr_state = TALKIE_ISR_IDLE;
+						SPDR = TALKIE_SB_FULL;
 						#ifdef BROADCAST_SPI_DEBUG_1
 						Serial.println(F("\t\tERROR: Slave buffer overflow"));
 						#endif
-                    }
-                    break;
-                case TALKIE_SB_SEND:
-					if (_sending_index < _sending_length) {
-						SPDR = _sending_buffer[_sending_index];		// This way avoids being the critical path (in advance)
-					} else if (_sending_index == _sending_length) {
+					}
+					return;
+				}
+				break;
+			case TALKIE_ISR_SEND:
+				if (c < 128) {
+					uint8_t sending_index = _sending_index;
+					uint8_t sending_length = _sending_length;
+					if (sending_index < sending_length) {
+						SPDR = _sending_buffer[sending_index];		// This way avoids being the critical path (in advance)
+					} else if (sending_index == sending_length) {
 						SPDR = TALKIE_SB_LAST;	// Asks for the TALKIE_SB_LAST char
 					} else {	// Less missed sends this way
 						SPDR = TALKIE_SB_END;		// All chars have been checked
 					}
 					// Starts checking 2 indexes after
-					if (_sending_index > 1) {    // Two positions of delay
-						if (c == _sending_buffer[_validation_index]) {	// Checks all chars
-							_validation_index++; // Starts checking after two sent
+					if (sending_index > 1) {    // Two positions of delay
+						uint8_t validation_index = _validation_index;
+						if (c == _sending_buffer[validation_index]) {	// Checks all chars
+							_validation_index = validation_index + 1; // Starts checking after two sent
 						} else {
-							_transmission_mode = TALKIE_SB_NONE;  // Makes sure no more communication is done, regardless
+							_isr_state = TALKIE_ISR_IDLE;  // Makes sure no more communication is done, regardless
 							SPDR = TALKIE_SB_ERROR;
 							#ifdef BROADCAST_SPI_DEBUG_1
 							Serial.println(F("\t\tERROR: Sent char mismatch"));
 							#endif
-							break;
+							return;
 						}
 					}
-					_sending_index++;
-                    break;
-                default:
-                    SPDR = TALKIE_SB_NACK;
-            }
-
-        } else {    // It's a control message 0xFX
-            
-            // switch O(1) is more efficient than an if-else O(n) sequence because the compiler uses a jump table
-
-            switch (c) {
-                case TALKIE_SB_RECEIVE:
-                    if (_received_buffer) {
-						if (!_received_length) {
-							_transmission_mode = TALKIE_SB_RECEIVE;
-							_receiving_index = 0;
-							SPDR = TALKIE_SB_READY;	// Doing it at the end makes sure everything above was actually set
-						} else {
-                        	SPDR = TALKIE_SB_BUSY;
-							#ifdef BROADCAST_SPI_DEBUG_1
-							Serial.println(F("\t\tBUSY: I'm busy (TALKIE_SB_RECEIVE)"));
-							#endif
-						}
-                    } else {
-                        SPDR = TALKIE_SB_VOID;
-						#ifdef BROADCAST_SPI_DEBUG_1
-						Serial.println(F("\t\tERROR: Receiving buffer pointer NOT set"));
-						#endif
-                    }
-                    break;
-                case TALKIE_SB_SEND:
-                    if (_sending_buffer) {
-                        if (_sending_length) {
-							if (_sending_length > TALKIE_BUFFER_SIZE) {
-								_sending_length = 0;
-								SPDR = TALKIE_SB_FULL;
-							} else {
-								_transmission_mode = TALKIE_SB_SEND;
-								_sending_index = 0;
-								_validation_index = 0;
-								SPDR = TALKIE_SB_READY;	// Doing it at the end makes sure everything above was actually set
-							}
-                        } else {
-                            SPDR = TALKIE_SB_NONE;
-							#ifdef BROADCAST_SPI_DEBUG_2
-							Serial.println(F("\tNothing to be sent"));
-							#endif
-                        }
-                    } else {
-                        SPDR = TALKIE_SB_VOID;
-						#ifdef BROADCAST_SPI_DEBUG_1
-						Serial.println(F("\t\tERROR: Sending buffer pointer NOT set"));
-						#endif
-                    }
-                    break;
-                case TALKIE_SB_LAST:
-					if (_transmission_mode == TALKIE_SB_RECEIVE) {
-						SPDR = _received_buffer[_receiving_index - 1];
-                    } else if (_transmission_mode == TALKIE_SB_SEND && _sending_length > 0) {
-						SPDR = _sending_buffer[_sending_length - 1];
-                    } else {
-						SPDR = TALKIE_SB_NONE;
+					_sending_index = sending_index + 1;
+					return;
+				}
+				break;
+			case TALKIE_ISR_RECEIVE_LENGTH:
+				if (c && c <= TALKIE_BUFFER_SIZE) {
+					_block_length = c;
+					_isr_state = TALKIE_ISR_RECEIVE_FRAME;
+				} else {
+					_isr_state = TALKIE_ISR_IDLE;
+					SPDR = TALKIE_SB_ERROR;
+				}
+				return;
+			case TALKIE_ISR_RECEIVE_FRAME: {
+				uint8_t block_index = _block_index;
+				uint8_t block_length = _block_length;
+				uint16_t block_crc = _crc16(_block_crc, c);
+				_block_crc = block_crc;
+				if (block_index < block_length) {
+					_received_buffer[block_index] = c;
+				}
+				_block_index = ++block_index;
+				if (block_index == block_length + 2) {	// Payload and CRC received
+					if (!block_crc) {	// The CRC of the payload followed by its CRC is 0
+						_receiving_index = block_length;
+						_isr_state = TALKIE_ISR_RECEIVE;	// So that the Master END sets it as received
+						SPDR = TALKIE_SB_ACK;
+					} else {
+						_isr_state = TALKIE_ISR_IDLE;
+						SPDR = TALKIE_SB_ERROR;
 					}
-                    break;
-                case TALKIE_SB_END:
-					if (_transmission_mode == TALKIE_SB_RECEIVE) {
-						_received_length = _receiving_index;
-						#ifdef BROADCAST_SPI_DEBUG_1
-						Serial.println(F("\tReceived message"));
-						#endif
-                    } else if (_transmission_mode == TALKIE_SB_SEND) {
-                        _sending_length = 0;	// Makes sure the sending buffer is zeroed
-						#ifdef BROADCAST_SPI_DEBUG_1
-						Serial.println(F("\tSent message"));
-						#endif
+				}
+				return;
+			}
+			case TALKIE_ISR_SEND_FRAME: {
+				uint8_t block_index = _block_index;
+				if (block_index < _block_length) {
+					_block_index = block_index + 1;
+					SPDR = _sending_buffer[block_index];
+				} else {
+					_isr_state = TALKIE_ISR_SEND_CRC;
+					SPDR = (uint8_t)(_sending_crc >> 8);
+				}
+				return;
+			}
+			case TALKIE_ISR_SEND_CRC:
+				_isr_state = TALKIE_ISR_SEND_END;
+				SPDR = (uint8_t)_sending_crc;
+				return;
+			case TALKIE_ISR_SEND_END:
+				_isr_state = TALKIE_ISR_SEND;	// So that the Master END or ERROR are processed as usual
+				SPDR = TALKIE_SB_NONE;
+				return;
+			case TALKIE_ISR_EXCHANGE_LENGTH:	// The first byte is the Master length
+				if (c <= TALKIE_BUFFER_SIZE) {
+					uint8_t exchange_length = _exchange_length;
+					_block_length = c;
+					_exchange_slots = c + 2 > exchange_length + 3 ? c + 2 : exchange_length + 3;
+					_isr_state = TALKIE_ISR_EXCHANGE_FRAME;
+					SPDR = exchange_length;
+				} else {
+					_isr_state = TALKIE_ISR_IDLE;
+					SPDR = TALKIE_SB_ERROR;
+				}
+				return;
+			case TALKIE_ISR_EXCHANGE_FRAME: {
+				// The Master frame comes in while the Slave one goes out one byte behind, after its length
+				uint8_t slot_i = _block_index;
+				uint8_t block_length = _block_length;
+				uint8_t exchange_length = _exchange_length;
+				uint16_t block_crc = _block_crc;
+				if (slot_i < block_length + 2) {	// Payload and CRC
+					block_crc = _crc16(block_crc, c);
+					_block_crc = block_crc;
+					if (slot_i < block_length) {
+						_received_buffer[slot_i] = c;
 					}
-                    _transmission_mode = TALKIE_SB_NONE;
-					SPDR = TALKIE_SB_DONE;	// Doing it at the end makes sure everything above was actually set
-                    break;
-                case TALKIE_SB_ACK:
-                    SPDR = TALKIE_SB_ACK;
-                    break;
-                case TALKIE_SB_ERROR:
-                case TALKIE_SB_FULL:
-					_transmission_mode = TALKIE_SB_NONE;
-					SPDR = TALKIE_SB_ACK;
+				}
+				_block_index = slot_i + 1;
+				if (slot_i + 1 == _exchange_slots) {	// The next byte carries the verdict on the Master frame
+					_isr_state = TALKIE_ISR_EXCHANGE_VERDICT;
+					if (!block_length) {
+						SPDR = TALKIE_SB_ACK;
+					} else if (!block_crc) {
+						_received_length = block_length;
+						SPDR = TALKIE_SB_ACK;
+					} else {
+						SPDR = TALKIE_SB_ERROR;
+					}
+				} else if (slot_i < exchange_length) {
+					SPDR = _sending_buffer[slot_i];
+				} else if (slot_i == exchange_length) {
+					SPDR = (uint8_t)(_sending_crc >> 8);
+				} else if (slot_i == exchange_length + 1) {
+					SPDR = (uint8_t)_sending_crc;
+				} else {
+					SPDR = TALKIE_SB_NONE;
+				}
+				return;
+			}
+			case TALKIE_ISR_EXCHANGE_VERDICT:	// The Master verdict on the Slave frame, only END takes it
+				if (c == TALKIE_SB_END && _exchange_length) {
+					_sending_length = 0;
+				}
+				_isr_state = TALKIE_ISR_IDLE;
+				SPDR = TALKIE_SB_DONE;
+				return;
+			// All Slaves are listening, so, nothing is loaded into SPDR
+			case TALKIE_ISR_BROADCAST_LENGTH:
+				if (c && c <= TALKIE_BUFFER_SIZE) {
+					_block_length = c;
+					_isr_state = TALKIE_ISR_BROADCAST_FRAME;
+				} else {
+					_isr_state = TALKIE_ISR_BROADCAST_IGNORE;
+				}
+				return;
+			case TALKIE_ISR_BROADCAST_FRAME: {
+				uint8_t block_index = _block_index;
+				uint8_t block_length = _block_length;
+				uint16_t block_crc = _crc16(_block_crc, c);
+				_block_crc = block_crc;
+				if (block_index < block_length) {
+					_received_buffer[block_index] = c;
+				}
+				_block_index = ++block_index;
+				if (block_index == block_length + 2) {	// Payload and CRC received
+					if (!block_crc) {
+						_received_length = block_length;
+						_broadcast_status = TALKIE_SB_ACK;
+					}
+					_isr_state = TALKIE_ISR_BROADCAST_IGNORE;
+				}
+				return;
+			}
+			case TALKIE_ISR_BROADCAST_IGNORE:
+				return;
+			default:	// TALKIE_ISR_IDLE and TALKIE_ISR_VERSION
+				if (c < 128) {
+					SPDR = TALKIE_SB_NACK;
+					return;
+				}
+				break;
+		}
+
+		// It's a control message 0xFX
+
+		// switch O(1) is more efficient than an if-else O(n) sequence because the compiler uses a jump table
+
+		switch (c) {
+			case TALKIE_SB_RECEIVE:
+				if (!_received_length) {
+					_isr_state = TALKIE_ISR_RECEIVE;
+					_receiving_index = 0;
+					SPDR = TALKIE_SB_READY;	// Doing it at the end makes sure everything above was actually set
+				} else {
+					SPDR = TALKIE_SB_BUSY;
 					#ifdef BROADCAST_SPI_DEBUG_1
-					Serial.println(F("\tTransmission ended with received TALKIE_SB_ERROR or TALKIE_SB_FULL"));
+					Serial.println(F("\t\tBUSY: I'm busy (TALKIE_SB_RECEIVE)"));
 					#endif
-                    break;
-                default:
-                    SPDR = TALKIE_SB_NACK;
-            }
-        }
+				}
+				break;
+			case TALKIE_SB_SEND:
+				if (_sending_length) {
+					if (_sending_length > TALKIE_BUFFER_SIZE) {
+						_sending_length = 0;
+						SPDR = TALKIE_SB_FULL;
+					} else {
+						_isr_state = TALKIE_ISR_SEND;
+						_sending_index = 0;
+						_validation_index = 0;
+						SPDR = TALKIE_SB_READY;	// Doing it at the end makes sure everything above was actually set
+					}
+				} else {
+					SPDR = TALKIE_SB_NONE;
+					#ifdef BROADCAST_SPI_DEBUG_2
+					Serial.println(F("\tNothing to be sent"));
+					#endif
+				}
+				break;
+			case TALKIE_SB_LAST:
+				if (_isr_state == TALKIE_ISR_RECEIVE) {
+					SPDR = _received_buffer[_receiving_index - 1];
+				} else if (_isr_state == TALKIE_ISR_SEND && _sending_length > 0) {
+					SPDR = _sending_buffer[_sending_length - 1];
+				} else {
+					SPDR = TALKIE_SB_NONE;
+				}
+				break;
+			case TALKIE_SB_END:
+				if (_isr_state == TALKIE_ISR_RECEIVE) {
+					_received_length = _receiving_index;
+					#ifdef BROADCAST_SPI_DEBUG_1
+					Serial.println(F("\tReceived message"));
+					#endif
+				} else if (_isr_state == TALKIE_ISR_SEND) {
+					_sending_length = 0;	// Makes sure the sending buffer is zeroed
+					#ifdef BROADCAST_SPI_DEBUG_1
+					Serial.println(F("\tSent message"));
+					#endif
+				}
+				_isr_state = TALKIE_ISR_IDLE;
+				SPDR = TALKIE_SB_DONE;	// Doing it at the end makes sure everything above was actually set
+				break;
+			case TALKIE_SB_ACK:
+				// A second ACK in a row is answered with the version
+				if (_isr_state == TALKIE_ISR_VERSION) {
+					_isr_state = TALKIE_ISR_IDLE;
+					SPDR = _broadcast ? TALKIE_SPI_VERSION : TALKIE_SPI_NO_BROADCAST_VERSION;
+				} else {
+					_isr_state = TALKIE_ISR_VERSION;
+					SPDR = TALKIE_SB_ACK;
+				}
+				break;
+			case TALKIE_SB_RECEIVE_BLOCK:
+				if (!_received_length) {
+					_block_index = 0;
+					_block_crc = 0xFFFF;
+					_isr_state = TALKIE_ISR_RECEIVE_LENGTH;
+					SPDR = TALKIE_SB_READY;	// Doing it at the end makes sure everything above was actually set
+				} else {
+					SPDR = TALKIE_SB_BUSY;
+				}
+				break;
+			case TALKIE_SB_SEND_BLOCK:
+				if (_sending_length) {
+					_block_length = _sending_length;
+					_block_index = 0;
+					_isr_state = TALKIE_ISR_SEND_FRAME;
+					SPDR = _sending_length;	// Doing it at the end makes sure everything above was actually set
+				} else {
+					SPDR = TALKIE_SB_NONE;
+				}
+				break;
+			case TALKIE_SB_EXCHANGE_BLOCK:
+				if (!_received_length) {
+					_exchange_length = _sending_length;
+					_block_index = 0;
+					_block_crc = 0xFFFF;
+					_isr_state = TALKIE_ISR_EXCHANGE_LENGTH;
+					SPDR = TALKIE_SB_READY;	// Doing it at the end makes sure everything above was actually set
+				} else {
+					SPDR = TALKIE_SB_BUSY;
+				}
+				break;
+			case TALKIE_SB_BROADCAST_BLOCK:
+				DDRB &= ~_BV(DDB4);	// Keeps MISO (PB4) released, shared by all the selected Slaves
+				_block_index = 0;
+				_block_crc = 0xFFFF;
+				if (_received_length) {	// A busy Slave ignores the frame
+					_broadcast_status = TALKIE_SB_BUSY;
+					_isr_state = TALKIE_ISR_BROADCAST_IGNORE;
+				} else {
+					_broadcast_status = TALKIE_SB_ERROR;	// ERROR until checked
+					_isr_state = TALKIE_ISR_BROADCAST_LENGTH;
+				}
+				break;
+			case TALKIE_SB_BROADCAST_STATUS:
+				SPDR = _broadcast_status;
+				_broadcast_status = TALKIE_SB_NONE;
+				break;
+			case TALKIE_SB_ERROR:
+			case TALKIE_SB_FULL:
+				_isr_state = TALKIE_ISR_IDLE;
+				SPDR = TALKIE_SB_ACK;
+				#ifdef BROADCAST_SPI_DEBUG_1
+				Serial.println(F("\tTransmission ended with received TALKIE_SB_ERROR or TALKIE_SB_FULL"));
+				#endif
+				break;
+			default:
+				SPDR = TALKIE_SB_NACK;
+		}
+    }
+
+
+    // Actual SS pin change handler, called by the Slave loop instead without `TALKIE_SPI_SS_PCINT`
+    static void handleSS_Interrupt() {
+		// Only the rising SS matters, neither a block frame nor the version query continue on the next transaction
+		if (PINB & _BV(PINB2)) {
+			if (_broadcast) {
+				DDRB &= ~_BV(DDB4);	// Released until the first byte of the next transaction
+			}
+			if (_isr_state >= TALKIE_ISR_VERSION) {
+				_isr_state = TALKIE_ISR_IDLE;
+			}
+		}
     }
 
 };
@@ -21,9 +21,9 @@ https://github.com/ruiseixasm/JsonTalkie
 
 
 const char talker_name[] = "serial";
-const char talker_desc[] = "I'm a serial talker";
+const char talker_desc[] PROGMEM = "I'm a serial talker";
 SerialManifesto serial_manifesto;
-JsonTalker talker = JsonTalker(talker_name, talker_desc, &serial_manifesto);
+JsonTalker talker = JsonTalker(talker_name, FPSTR(talker_desc), &serial_manifesto);
 
 // Singleton requires the & (to get a reference variable)
 auto& serial_socket = SocketSerial::instance();
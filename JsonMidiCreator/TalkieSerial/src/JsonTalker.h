@@ -36,10 +36,20 @@ https://github.com/ruiseixasm/JsonTalkie
 #include <Arduino.h>        // Needed for Serial given that Arduino IDE only includes Serial in .ino files!
 #include "BroadcastSocket.h"
 
+#ifndef FPSTR	// Already defined by the ESP cores
+#define FPSTR(pstr_pointer) (reinterpret_cast<const __FlashStringHelper*>(pstr_pointer))
+#endif
+
 
 // #define JSON_TALKER_DEBUG
 // #define JSON_TALKER_DEBUG_NEW
 
+// Bulk replies (LIST and TALK) are released by the Talker loop, one message at a time,
+// so that calls aren't held behind them, at the cost of a message copy per Talker
+#if !defined(__AVR__) && !defined(TALKIE_NO_DEFERRED_BULK)
+#define TALKIE_DEFERRED_BULK
+#endif
+
 using LinkType			= TalkieCodes::LinkType;
 using TalkerMatch 		= TalkieCodes::TalkerMatch;
 using BroadcastValue 	= TalkieCodes::BroadcastValue;
@@ -80,6 +90,19 @@ public:
         const char* desc;
     };
 
+
+	/**
+	 * @brief The state of an Action once started or polled
+	 * 
+	 * A pending Action is polled by the Talker loop until it's done, only then
+	 * being replied with its roger.
+	 */
+	enum class ActionState : uint8_t {
+		TALKIE_AS_ROGER,	///< Done with success
+		TALKIE_AS_NEGATIVE,	///< Done without success
+		TALKIE_AS_PENDING	///< Still running, to be polled again
+	};
+
 	
 private:
     
@@ -92,6 +115,48 @@ private:
     uint8_t _channel = 255;	// Channel 255 means NO channel response
 	Original _original_message = {0, MessageValue::TALKIE_MSG_NOISE};
     bool _muted_calls = false;
+	bool _desc_in_flash = false;	// The description was given as a flash (PROGMEM) string
+	#ifdef TALKIE_TRACE
+	uint16_t _trace_node = JsonMessage::_name_hash(_name);	// Hashed once, at construction
+	#endif
+
+	// The caller of the pending Action, kept in order to reply once it's done
+	uint8_t _pending_action = 255;	// 255 means no pending Action
+	bool _pending_reply = false;
+	BroadcastValue _pending_broadcast = BroadcastValue::TALKIE_BC_NONE;
+	ValueType _pending_action_type = ValueType::TALKIE_VT_VOID;
+	uint16_t _pending_identity = 0;
+	char _pending_caller[TALKIE_NAME_LEN] = {'\0'};
+
+	#ifdef TALKIE_DEFERRED_BULK
+	JsonMessage _bulk_message;		// The echo of the bulk request, reused for each reply
+	MessageValue _bulk_value = MessageValue::TALKIE_MSG_NOISE;
+	uint8_t _bulk_next = 0;
+	uint8_t _bulk_total = 0;
+
+
+	/**
+     * @brief Tells if there are still bulk replies to be released
+     */
+	bool _bulkPending() const { return _bulk_next < _bulk_total; }
+
+
+	/**
+     * @brief Keeps the echo of a bulk request so that its replies are released by the Talker loop
+     * @param json_message The echo message to be used as template for each reply
+     * @param bulk_value The request being replied, LIST, TALK or the SYSTEM trace
+     * @param bulk_total The total number of replies to be released
+     */
+	void _deferBulk(const JsonMessage& json_message, MessageValue bulk_value, uint8_t bulk_total) {
+		_bulk_message = json_message;
+		_bulk_value = bulk_value;
+		_bulk_next = 0;
+		_bulk_total = bulk_total;
+	}
+
+
+	void _releaseBulk();
+	#endif
 
 
 	/**
@@ -217,12 +282,24 @@ private:
 	BroadcastSocket* _getSocket(uint8_t socket_index);
 
 
+	/** @brief Gets the amount of duplicated messages dropped by the Repeater */
+	uint16_t _duplicatesCount();
+
+
 	const char* _manifesto_name() const;
 	uint8_t _actionsCount() const;
-	const Action* _getActionsArray() const;
+	void _setActionName(JsonMessage& json_message, uint8_t index) const;
+	void _setListedAction(JsonMessage& json_message, uint8_t index) const;
+	void _setDesc(JsonMessage& json_message) const;
+	#ifdef TALKIE_TRACE
+	void _setTraceEvent(JsonMessage& json_message, uint8_t event_i) const;
+	#endif
 	uint8_t _actionIndex(const char* name) const;
 	uint8_t _actionIndex(uint8_t index) const;
-	bool _actionByIndex(uint8_t index, JsonMessage& json_message, TalkerMatch talker_match);
+	ActionState _startAction(uint8_t index, JsonMessage& json_message, TalkerMatch talker_match);
+	ActionState _pollAction(uint8_t index, JsonMessage& json_message);
+	void _keepCaller(JsonMessage& json_message);
+	void _replyPending();
 	void _echo(JsonMessage& json_message, TalkerMatch talker_match);
 	void _error(JsonMessage& json_message, TalkerMatch talker_match);
 	void _noise(JsonMessage& json_message, TalkerMatch talker_match);
@@ -236,6 +313,15 @@ public:
     JsonTalker(const char* name, const char* desc, TalkerManifesto* manifesto = nullptr, uint8_t channel = 255)
         : _name(name), _desc(desc), _manifesto(manifesto), _channel(channel) {}
 
+	/**
+     * @brief Constructor with the description stored in flash, sparing its RAM on AVR boards
+	 * 
+	 * With the description declared like `const char talker_desc[] PROGMEM = "I'm a talker";`:
+	 * `JsonTalker talker = JsonTalker(talker_name, FPSTR(talker_desc), &talker_manifesto);`
+     */
+    JsonTalker(const char* name, const __FlashStringHelper* desc, TalkerManifesto* manifesto = nullptr, uint8_t channel = 255)
+        : _name(name), _desc(reinterpret_cast<const char*>(desc)), _manifesto(manifesto), _channel(channel), _desc_in_flash(true) {}
+
 
 	/**
      * @brief Method intended to be called by the Repeater class by its public loop method
@@ -259,6 +345,8 @@ public:
     /**
 	 * @brief Get the description of the Talker
 	 * @return A pointer to the Talker description string
+	 * 
+	 * @note It points to flash if the Talker was constructed with a flash description.
      */
 	const char* get_desc() const { return _desc; }
 
@@ -279,6 +367,15 @@ public:
 	bool get_muted() const { return _muted_calls; }
 
 
+    /**
+     * @brief Get the pending state of the Talker
+     * @return Returns true if an Action is still pending
+     * 
+     * @note Only one Action may be pending at a time, a second one is replied as negative
+     */
+	bool get_pending() const { return _pending_action < 255; }
+
+
     /**
      * @brief Get the Link Type with the Message Repeater
      * @return Returns the Link Type (ex. DOWN_LINKED)
@@ -303,7 +400,7 @@ public:
      * @brief Set channel number
      * @param channel Channel number for which the Talker will respond
      */
-    void set_channel(uint8_t channel) { _channel = channel; }
+    void set_channel(uint8_t channel);
 
 
     /**
@@ -339,6 +436,10 @@ public:
 		Serial.println(static_cast<int>( message_value ));
 		#endif
 
+		#ifdef TALKIE_TRACE
+		TalkieTrace::instance()._record(TalkieTrace::Hop::TALKIE_HOP_HANDLED, _trace_node, json_message);
+		#endif
+
         switch (message_value) {
 
 			case MessageValue::TALKIE_MSG_CALL:
@@ -367,8 +468,19 @@ public:
 							Serial.println(F(", now being processed..."));
 							#endif
 
+							// Only one Action at a time, so, while one is pending any other call is negative
+							ActionState action_state = ActionState::TALKIE_AS_NEGATIVE;
+							if (!get_pending()) {
+								// The caller is kept before the Action changes the message
+								_keepCaller(json_message);
+								action_state = _startAction(index_found_i, json_message, talker_match);
+								if (action_state == ActionState::TALKIE_AS_PENDING) {
+									_pending_action = index_found_i;
+									break;	// Replied by the Talker loop once done
+								}
+							}
 							// ROGER should be implicit for CALL to spare json string size for more data index value nth
-							if (!_actionByIndex(index_found_i, json_message, talker_match)) {
+							if (action_state != ActionState::TALKIE_AS_ROGER) {
 								json_message.set_roger_value(RogerValue::TALKIE_RGR_NEGATIVE);
 							}
 						} else {
@@ -386,7 +498,13 @@ public:
 			
 			case MessageValue::TALKIE_MSG_TALK:
 				json_message.set_message_value(MessageValue::TALKIE_MSG_ECHO);
-				json_message.set_nth_value_string(0, _desc);
+				#ifdef TALKIE_DEFERRED_BULK
+				if (_message_repeater && !_bulkPending()) {
+					_deferBulk(json_message, MessageValue::TALKIE_MSG_TALK, 1);
+					break;
+				}
+				#endif
+				_setDesc(json_message);
 				// In the end sends back the processed message (single message, one-to-one)
 				transmitToRepeater(json_message);
 				break;
@@ -400,7 +518,7 @@ public:
 					Serial.println(json_message.get_nth_value_number(0));
 					#endif
 
-					_channel = json_message.get_nth_value_number(0);
+					set_channel(json_message.get_nth_value_number(0));
 				}
 				json_message.set_nth_value_number(0, _channel);
 				// In the end sends back the processed message (single message, one-to-one)
@@ -417,12 +535,19 @@ public:
 				json_message.set_message_value(MessageValue::TALKIE_MSG_ECHO);
 				if (_manifesto) {
 					uint8_t total_actions = _actionsCount();	// This makes the access safe
-					const Action* actions = _getActionsArray();
+					#ifdef TALKIE_DEFERRED_BULK
+					if (_message_repeater && total_actions) {
+						if (_bulkPending()) {	// Still releasing a previous request
+							json_message.set_roger_value(RogerValue::TALKIE_RGR_NEGATIVE);
+							transmitToRepeater(json_message);	// One-to-One
+						} else {
+							_deferBulk(json_message, MessageValue::TALKIE_MSG_LIST, total_actions);
+						}
+						break;
+					}
+					#endif
 					for (uint8_t action_i = 0; action_i < total_actions; ++action_i) {
-						json_message.remove_all_nth_values();	// Makes sure there is space for each new action
-						json_message.set_nth_value_number(0, action_i);
-						json_message.set_nth_value_string(1, actions[action_i].name);
-						json_message.set_nth_value_string(2, actions[action_i].desc);
+						_setListedAction(json_message, action_i);
 						transmitToRepeater(json_message);	// Many-to-One
 					}
 					if (!total_actions) {
@@ -469,9 +594,9 @@ public:
 								uint8_t sockets_count = _socketsCount();
 								for (uint8_t socket_i = 0; socket_i < sockets_count; ++socket_i) {
 									const BroadcastSocket* socket = _getSocket(socket_i);	// Safe sockets_count already
-									uint16_t total_drops = socket->get_drops_count();
 									json_message.set_nth_value_number(0, socket_i);
 									json_message.set_nth_value_number(1, socket->get_drops_count());
+									json_message.set_nth_value_number(2, socket->get_overflows_count());
 									transmitToRepeater(json_message);	// Many-to-One
 								}
 								if (!sockets_count) {
@@ -499,7 +624,6 @@ public:
 								uint8_t sockets_count = _socketsCount();
 								for (uint8_t socket_i = 0; socket_i < sockets_count; ++socket_i) {
 									const BroadcastSocket* socket = _getSocket(socket_i);	// Safe sockets_count already
-									uint16_t total_drops = socket->get_drops_count();
 									json_message.set_nth_value_number(0, socket_i);
 									json_message.set_nth_value_number(1, socket->get_max_delay());
 									transmitToRepeater(json_message);	// Many-to-One
@@ -512,12 +636,80 @@ public:
 							}
 							break;
 
+						case SystemValue::TALKIE_SYS_RATE:
+							if (json_message.get_nth_value_type(0) == ValueType::TALKIE_VT_INTEGER) {
+								uint8_t socket_index = (uint8_t)json_message.get_nth_value_number(0);
+								BroadcastSocket* socket = _getSocket(socket_index);
+								if (socket) {
+									if (json_message.get_nth_value_type(1) == ValueType::TALKIE_VT_INTEGER) {
+										uint16_t source_rate = socket->get_source_rate();
+										if (json_message.get_nth_value_type(2) == ValueType::TALKIE_VT_INTEGER) {
+											source_rate = (uint16_t)json_message.get_nth_value_number(2);
+										}
+										socket->set_rate( (uint16_t)json_message.get_nth_value_number(1), source_rate );
+									}
+									json_message.set_nth_value_number(1, socket->get_socket_rate());
+									json_message.set_nth_value_number(2, socket->get_source_rate());
+									json_message.set_nth_value_number(3, socket->get_limited_count());
+								} else {
+									json_message.set_roger_value(RogerValue::TALKIE_RGR_NO_JOY);
+								}
+							} else {
+								uint8_t sockets_count = _socketsCount();
+								for (uint8_t socket_i = 0; socket_i < sockets_count; ++socket_i) {
+									const BroadcastSocket* socket = _getSocket(socket_i);	// Safe sockets_count already
+									json_message.set_nth_value_number(0, socket_i);
+									json_message.set_nth_value_number(1, socket->get_socket_rate());
+									json_message.set_nth_value_number(2, socket->get_source_rate());
+									json_message.set_nth_value_number(3, socket->get_limited_count());
+									transmitToRepeater(json_message);	// Many-to-One
+								}
+								if (!sockets_count) {
+									json_message.set_roger_value(RogerValue::TALKIE_RGR_NO_JOY);
+								} else {
+									return;	// All transmissions already done by the if condition above
+								}
+							}
+							break;
+
+						case SystemValue::TALKIE_SYS_TRACE:
+							#ifdef TALKIE_TRACE
+							{
+								TalkieTrace& trace = TalkieTrace::instance();
+								uint8_t events_count = trace.get_events_count();
+								#ifdef TALKIE_DEFERRED_BULK
+								if (_message_repeater && events_count) {
+									if (_bulkPending()) {	// Still releasing a previous request
+										json_message.set_roger_value(RogerValue::TALKIE_RGR_NEGATIVE);
+										break;
+									}
+									trace.set_paused(true);		// Resumed by the last release
+									_deferBulk(json_message, MessageValue::TALKIE_MSG_SYSTEM, events_count);
+									return;
+								}
+								#endif
+								trace.set_paused(true);		// The replies aren't traced
+								for (uint8_t event_i = 0; event_i < events_count; ++event_i) {
+									_setTraceEvent(json_message, event_i);
+									transmitToRepeater(json_message);	// Many-to-One
+								}
+								trace.set_paused(false);
+								if (!events_count) {
+									json_message.set_roger_value(RogerValue::TALKIE_RGR_NIL);
+								} else {
+									return;	// All transmissions already done by the if condition above
+								}
+							}
+							#else
+							json_message.set_roger_value(RogerValue::TALKIE_RGR_NO_JOY);
+							#endif
+							break;
+
 						case SystemValue::TALKIE_SYS_SOCKET:
 							{
 								uint8_t sockets_count = _socketsCount();
 								for (uint8_t socket_i = 0; socket_i < sockets_count; ++socket_i) {
 									const BroadcastSocket* socket = _getSocket(socket_i);	// Safe sockets_count already
-									uint16_t total_drops = socket->get_drops_count();
 									json_message.set_nth_value_number(0, socket_i);
 									json_message.set_nth_value_string(1, socket->class_name());
 									transmitToRepeater(json_message);	// Many-to-One
@@ -530,6 +722,42 @@ public:
 							}
 							break;
 
+						case SystemValue::TALKIE_SYS_POLLS:
+							{
+								bool any_polled = false;
+								uint8_t sockets_count = _socketsCount();
+								for (uint8_t socket_i = 0; socket_i < sockets_count; ++socket_i) {
+									const BroadcastSocket* socket = _getSocket(socket_i);	// Safe sockets_count already
+									uint8_t polled_count = socket->get_polled_count();
+									for (uint8_t polled_i = 0; polled_i < polled_count; ++polled_i) {
+										uint16_t polls, replies, errors;
+										if (socket->get_poll_stats(polled_i, polls, replies, errors)) {
+											json_message.set_nth_value_number(0, socket_i);
+											json_message.set_nth_value_number(1, polled_i);
+											json_message.set_nth_value_number(2, polls);
+											json_message.set_nth_value_number(3, replies);
+											json_message.set_nth_value_number(4, errors);
+											transmitToRepeater(json_message);	// Many-to-One
+											any_polled = true;
+										}
+									}
+								}
+								if (!any_polled) {
+									json_message.set_roger_value(RogerValue::TALKIE_RGR_NO_JOY);
+								} else {
+									return;	// All transmissions already done by the loop above
+								}
+							}
+							break;
+
+						case SystemValue::TALKIE_SYS_DUPLICATES:
+							if (_message_repeater) {
+								json_message.set_nth_value_number(0, _duplicatesCount());
+							} else {
+								json_message.set_roger_value(RogerValue::TALKIE_RGR_NO_JOY);
+							}
+							break;
+
 						case SystemValue::TALKIE_SYS_MANIFESTO:
 							if (_manifesto) {
 								json_message.set_nth_value_string(0, _manifesto_name());
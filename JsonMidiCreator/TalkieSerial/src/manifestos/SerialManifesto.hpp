@@ -19,6 +19,17 @@ https://github.com/ruiseixasm/JsonTalkie
 // #define GREEN_TALKER_DEBUG
 
 
+// The Actions are kept in flash (PROGMEM), sparing their RAM on AVR boards
+const char serial_on_name[] PROGMEM = "on";
+const char serial_on_desc[] PROGMEM = "Turns led ON";
+const char serial_off_name[] PROGMEM = "off";
+const char serial_off_desc[] PROGMEM = "Turns led OFF";
+const Action serial_calls[2] PROGMEM = {
+	{serial_on_name, serial_on_desc},
+	{serial_off_name, serial_off_desc}
+};
+
+
 class SerialManifesto : public TalkerManifesto {
 public:
 
@@ -31,24 +42,20 @@ protected:
 
     bool _is_led_on = false;  // keep track of state yourself, by default it's off
 
-    Action calls[2] = {
-		{"on", "Turns led ON"},
-		{"off", "Turns led OFF"}
-    };
-    
 public:
     
-    const Action* _getActionsArray() const override { return calls; }
+    const Action* _getActionsArray() const override { return serial_calls; }
 
     // Size methods
-    uint8_t _actionsCount() const override { return sizeof(calls)/sizeof(Action); }
+    uint8_t _actionsCount() const override { return sizeof(serial_calls)/sizeof(Action); }
+    bool _actionsInFlash() const override { return true; }
 
 
     // Index-based operations (simplified examples)
     bool _actionByIndex(uint8_t index, JsonTalker& talker, JsonMessage& json_message, TalkerMatch talker_match) override {
         (void)talker;		// Silence unused parameter warning
 		
-		if (index >= sizeof(calls)/sizeof(Action)) return false;
+		if (index >= sizeof(serial_calls)/sizeof(Action)) return false;
 		
 		// Actual implementation would do something based on index
 		switch(index) {
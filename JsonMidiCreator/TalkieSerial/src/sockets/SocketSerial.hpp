@@ -20,6 +20,15 @@ https://github.com/ruiseixasm/JsonTalkie
 // #define SOCKET_SERIAL_DEBUG
 // #define SOCKET_SERIAL_DEBUG_TIMING
 
+#define TALKIE_SERIAL_CHUNK 64		///< Bytes drained from Serial at once, same as the AVR RX buffer
+
+// SLIP special bytes (RFC 1055)
+#define SLIP_END 0xC0
+#define SLIP_ESC 0xDB
+#define SLIP_ESC_END 0xDC
+#define SLIP_ESC_ESC 0xDD
+
+
 class SocketSerial : public BroadcastSocket {
 public:
 
@@ -29,6 +38,15 @@ public:
 	unsigned long _reference_time = millis();
 	#endif
 
+    /**
+     * @enum Framing
+     * @brief How messages are delimited on the serial line
+     */
+	enum Framing : uint8_t {
+		FRAMING_JSON,	///< Plain JSON, delimited by its outer `{` and `}` (default)
+		FRAMING_SLIP	///< SLIP frames with a trailing CRC-16, robust at high baud rates
+	};
+
 
 protected:
 
@@ -37,59 +55,189 @@ protected:
 
 	JsonMessage _json_message;
 	bool _reading_serial = false;
+	Framing _framing = FRAMING_JSON;
 
+	// Bytes drained in bulk from Serial and not yet framed
+	uint8_t _chunk[TALKIE_SERIAL_CHUNK];
+	uint8_t _chunk_i = 0;
+	uint8_t _chunk_length = 0;
 
-    void _receive() override {
-    
-		#ifdef SOCKET_SERIAL_DEBUG_TIMING
-		_reference_time = millis();
-		#endif
+	// SLIP decoding state
+	bool _slip_escaping = false;
+	bool _slip_dropping = false;
+	uint8_t _slip_tail_count = 0;
+	uint16_t _slip_tail = 0;	// Last two decoded bytes, the CRC when the frame ends
+	uint16_t _slip_crc = 0xFFFF;
 
-		while (Serial.available()) {
-			char c = Serial.read();
 
-			char* message_buffer = _json_message._write_buffer();
-			if (_reading_serial) {
+    /**
+     * @brief Frames one more byte as plain JSON
+     * @param c The received byte
+     * @return true if the reading should stop for this loop
+     */
+	bool _frameJson(char c) {
 
-				size_t message_length = _json_message._get_length();
-				if (message_length < TALKIE_BUFFER_SIZE) {
-					if (c == '}' && message_length && message_buffer[message_length - 1] != '\\') {
+		char* message_buffer = _json_message._write_buffer();
+		if (_reading_serial) {
 
-						_reading_serial = false;
+			size_t message_length = _json_message._get_length();
+			if (message_length < TALKIE_BUFFER_SIZE) {
+				if (c == '}' && message_length && message_buffer[message_length - 1] != '\\') {
 
-						#ifdef SOCKET_SERIAL_DEBUG_TIMING
-						Serial.print(millis() - _reference_time);
-						#endif
+					_reading_serial = false;
+
+					#ifdef SOCKET_SERIAL_DEBUG_TIMING
+					Serial.print(millis() - _reference_time);
+					#endif
 
-						if (_json_message._append('}') && _json_message._validate_json()) {
-							_json_message._process_checksum();	// Has to validate and process the checksum
-							_startTransmission(_json_message);
-						}
-						return;
-					} else if (!_json_message._append(c)) {
-						return;
+					if (_json_message._append('}') && _json_message._validate_json()) {
+						_json_message._process_checksum();	// Has to validate and process the checksum
+						_startTransmission(_json_message);
 					}
-				} else {
-					_reading_serial = false;
-					_json_message._set_length(0);	// Reset to start writing
+					return true;
+				} else if (!_json_message._append(c)) {
+					return true;
 				}
-			} else if (c == '{') {
-				
-				_json_message._set_length(0);
-				_reading_serial = true;
+			} else {
+				_reading_serial = false;
+				_json_message._set_length(0);	// Reset to start writing
+			}
+		} else if (c == '{') {
+			
+			_json_message._set_length(0);
+			_reading_serial = true;
+
+			#ifdef SOCKET_SERIAL_DEBUG_TIMING
+			Serial.print("\n");
+			Serial.print(class_name());
+			Serial.print(": ");
+			#endif
+
+			_json_message._append('{');
+		}
+		return false;
+	}
+
+
+    /**
+     * @brief Frames one more byte as SLIP, the last two bytes of each frame being its CRC
+     * @param c The received byte
+     * @return true if the reading should stop for this loop
+     * 
+     * @note The CRC bytes are held back in `_slip_tail`, so that a full
+     *       `TALKIE_BUFFER_SIZE` message still fits the message buffer
+     */
+	bool _frameSlip(uint8_t c) {
+
+		if (c == SLIP_END) {
+
+			bool delivered = false;
+			if (!_slip_dropping && _slip_tail_count == 2 && _slip_crc == _slip_tail) {
 
 				#ifdef SOCKET_SERIAL_DEBUG_TIMING
-				Serial.print("\n");
-				Serial.print(class_name());
-				Serial.print(": ");
+				Serial.print(millis() - _reference_time);
 				#endif
 
-				_json_message._append('{');
+				if (_json_message._validate_json()) {
+					_json_message._process_checksum();	// Has to validate and process the checksum
+					_startTransmission(_json_message);
+					delivered = true;
+				}
+			}
+			#ifdef SOCKET_SERIAL_DEBUG
+			else if (_slip_tail_count) {
+				Serial.println(F("\tSocketSerial: Dropped a corrupted SLIP frame"));
+			}
+			#endif
+
+			// Resets for the next frame
+			_json_message._set_length(0);
+			_slip_escaping = false;
+			_slip_dropping = false;
+			_slip_tail_count = 0;
+			_slip_crc = 0xFFFF;
+			return delivered;
+		}
+		if (_slip_dropping) return false;
+
+		if (_slip_escaping) {
+			_slip_escaping = false;
+			if (c == SLIP_ESC_END) {
+				c = SLIP_END;
+			} else if (c == SLIP_ESC_ESC) {
+				c = SLIP_ESC;
+			} else {
+				_slip_dropping = true;	// Protocol violation
+				return false;
+			}
+		} else if (c == SLIP_ESC) {
+			_slip_escaping = true;
+			return false;
+		}
+
+		if (_slip_tail_count == 2) {
+			uint8_t data = (uint8_t)(_slip_tail >> 8);
+			_slip_crc = _crc16(_slip_crc, data);
+			if (!_json_message._append((char)data)) {
+				_slip_dropping = true;	// Too long, waits for the next SLIP_END
+				return false;
+			}
+		} else {
+			++_slip_tail_count;
+		}
+		_slip_tail = (_slip_tail << 8) | c;
+		return false;
+	}
+
+
+    void _receive() override {
+    
+		#ifdef SOCKET_SERIAL_DEBUG_TIMING
+		_reference_time = millis();
+		#endif
+
+		while (true) {
+			if (_chunk_i == _chunk_length) {
+				// Drains the available bytes at once instead of one Serial.read() each
+				int available = Serial.available();
+				if (available <= 0) return;
+				if (available > TALKIE_SERIAL_CHUNK) available = TALKIE_SERIAL_CHUNK;
+				_chunk_length = (uint8_t)Serial.readBytes(_chunk, (size_t)available);
+				_chunk_i = 0;
+				if (!_chunk_length) return;
 			}
+			uint8_t c = _chunk[_chunk_i++];
+			// The remaining bytes are kept for the next loop
+			if (_framing == FRAMING_SLIP ? _frameSlip(c) : _frameJson((char)c)) return;
 		}
     }
 
 
+    /**
+     * @brief Adds one byte to the outgoing frame, writing it when full
+     * @param frame The outgoing frame
+     * @param frame_i The position in the frame, reset when written
+     * @param c The byte to add
+     * @param escape If SLIP special bytes should be escaped
+     * @return false if Serial failed to write the frame
+     */
+	static bool _putSlip(uint8_t* frame, uint8_t& frame_i, uint8_t c, bool escape = true) {
+		if (frame_i > TALKIE_SERIAL_CHUNK - 2) {
+			if (Serial.write(frame, frame_i) != frame_i) return false;
+			frame_i = 0;
+		}
+		if (escape && c == SLIP_END) {
+			frame[frame_i++] = SLIP_ESC;
+			c = SLIP_ESC_END;
+		} else if (escape && c == SLIP_ESC) {
+			frame[frame_i++] = SLIP_ESC;
+			c = SLIP_ESC_ESC;
+		}
+		frame[frame_i++] = c;
+		return true;
+	}
+
+
     bool _send(const JsonMessage& json_message) override {
 
 		#ifdef SOCKET_SERIAL_DEBUG_TIMING
@@ -99,7 +247,24 @@ protected:
 
 		const char* message_buffer = json_message._read_buffer();
 		size_t message_length = json_message._get_length();
-		return Serial.write(message_buffer, message_length) == message_length;
+		if (_framing == FRAMING_JSON) {
+			return Serial.write(message_buffer, message_length) == message_length;
+		}
+
+		uint8_t frame[TALKIE_SERIAL_CHUNK];
+		uint8_t frame_i = 0;
+		uint16_t crc = 0xFFFF;
+		// A leading END flushes any line noise on the receiver side
+		bool written = _putSlip(frame, frame_i, SLIP_END, false);
+		for (size_t char_j = 0; written && char_j < message_length; ++char_j) {
+			crc = _crc16(crc, (uint8_t)message_buffer[char_j]);
+			written = _putSlip(frame, frame_i, (uint8_t)message_buffer[char_j]);
+		}
+		written = written
+			&& _putSlip(frame, frame_i, (uint8_t)(crc >> 8))
+			&& _putSlip(frame, frame_i, (uint8_t)crc)
+			&& _putSlip(frame, frame_i, SLIP_END, false);
+		return written && Serial.write(frame, frame_i) == frame_i;
     }
 
 
@@ -111,6 +276,23 @@ public:
         return instance;
     }
 
+
+    /**
+     * @brief Sets how messages are delimited on the serial line
+     * @param framing Either `FRAMING_JSON` (default) or `FRAMING_SLIP`
+     * 
+     * @note Both ends of the line have to use the same framing
+     */
+	void set_framing(Framing framing) {
+		_framing = framing;
+		_reading_serial = false;
+		_slip_escaping = false;
+		_slip_dropping = true;	// Syncs on the next SLIP_END
+		_slip_tail_count = 0;
+		_slip_crc = 0xFFFF;
+		_json_message._set_length(0);
+	}
+
 };
 
 #endif // SOCKET_SERIAL_HPP
@@ -15,30 +15,28 @@ https://github.com/ruiseixasm/JsonTalkie
 
 // COMPILE WITH ARDUINO BOARD
 #include "src/JsonTalker.h"
-#include "src/MessageRepeater.hpp"
+#include "src/StaticMessageRepeater.hpp"
 #include "src/manifestos/MultipleManifesto.hpp"
 #include "src/sockets/SocketSerial.hpp"
 #include "src/sockets/SPI_Arduino_Arduino_Master_Multiple.hpp"
 
 
 const char talker_name[] = "multiple";
-const char talker_desc[] = "I'm a multiple talker";
+const char talker_desc[] PROGMEM = "I'm a multiple talker";
 MultipleManifesto serial_manifesto;
-JsonTalker talker = JsonTalker(talker_name, talker_desc, &serial_manifesto);
+JsonTalker talker = JsonTalker(talker_name, FPSTR(talker_desc), &serial_manifesto);
 
 // Singleton requires the & (to get a reference variable)
 auto& serial_socket = SocketSerial::instance();
 int spi_pins[] = {SS};
 auto& spi_socket = SPI_Arduino_Arduino_Master_Multiple::instance(spi_pins, sizeof(spi_pins)/sizeof(int));
 
-// SETTING THE REPEATER
-BroadcastSocket* uplinked_sockets[] = { &serial_socket };
+// SETTING THE REPEATER (the topology is fixed at compile time)
+using UplinkedSockets = StaticSockets<SocketSerial>;
 JsonTalker* downlinked_talkers[] = { &talker };
-BroadcastSocket* downlinked_sockets[] = { &spi_socket };
-MessageRepeater message_repeater(
-		uplinked_sockets, sizeof(uplinked_sockets)/sizeof(BroadcastSocket*),
-		downlinked_talkers, sizeof(downlinked_talkers)/sizeof(JsonTalker*),
-		downlinked_sockets, sizeof(downlinked_sockets)/sizeof(BroadcastSocket*)
+using DownlinkedSockets = StaticSockets<SPI_Arduino_Arduino_Master_Multiple>;
+StaticMessageRepeater<UplinkedSockets, sizeof(downlinked_talkers)/sizeof(JsonTalker*), DownlinkedSockets> message_repeater(
+		UplinkedSockets(serial_socket), downlinked_talkers, DownlinkedSockets(spi_socket)
 	);
 
 
@@ -22,9 +22,9 @@ https://github.com/ruiseixasm/JsonTalkie
 
 
 const char talker_name[] = "single";
-const char talker_desc[] = "I'm a single talker";
+const char talker_desc[] PROGMEM = "I'm a single talker";
 SingleManifesto serial_manifesto;
-JsonTalker talker = JsonTalker(talker_name, talker_desc, &serial_manifesto);
+JsonTalker talker = JsonTalker(talker_name, FPSTR(talker_desc), &serial_manifesto);
 
 // Singleton requires the & (to get a reference variable)
 auto& serial_socket = SocketSerial::instance();
@@ -19,6 +19,18 @@ https://github.com/ruiseixasm/JsonTalkie
 #define BUZZ_PIN 2	// External BUZZER pin
 
 
+// The Actions are kept in flash (PROGMEM), sparing their RAM on AVR boards
+const char single_buzz_name[] PROGMEM = "buzz";
+const char single_buzz_desc[] PROGMEM = "Buzz a little";
+const char single_ms_name[] PROGMEM = "ms";
+const char single_ms_desc[] PROGMEM = "For how long";
+// ALWAYS MAKE SURE THE DIMENSIONS OF THE ARRAYS BELOW ARE THE CORRECT!
+const Action single_calls[2] PROGMEM = {
+	{single_buzz_name, single_buzz_desc},
+	{single_ms_name, single_ms_desc}
+};
+
+
 class SingleManifesto : public TalkerManifesto {
 public:
 
@@ -32,19 +44,13 @@ protected:
     uint16_t _buzz_duration_ms = 100;
 	uint16_t _buzz_start = 0;
 
-	// ALWAYS MAKE SURE THE DIMENSIONS OF THE ARRAYS BELOW ARE THE CORRECT!
-
-    Action calls[2] = {
-		{"buzz", "Buzz a little"},
-		{"ms", "For how long"}
-    };
-    
 public:
     
-    const Action* _getActionsArray() const override { return calls; }
+    const Action* _getActionsArray() const override { return single_calls; }
 
     // Size methods
-    uint8_t _actionsCount() const override { return sizeof(calls)/sizeof(Action); }
+    uint8_t _actionsCount() const override { return sizeof(single_calls)/sizeof(Action); }
+    bool _actionsInFlash() const override { return true; }
 
 
 	void _loop(JsonTalker& talker) override {
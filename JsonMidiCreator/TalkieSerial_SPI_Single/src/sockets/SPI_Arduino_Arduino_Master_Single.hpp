@@ -25,8 +25,11 @@ https://github.com/ruiseixasm/JsonTalkie
 // #define BROADCAST_SPI_DEBUG_TIMING
 
 
-#define send_delay_us 10
-#define receive_delay_us 10
+#define TALKIE_SPI_DELAY_US 10				///< Initial delay between bytes, the one safe for AVR Slaves
+#define TALKIE_SPI_MIN_DELAY_US 1			///< Shortest delay between bytes ever tried
+#define TALKIE_SPI_MAX_DELAY_US 40			///< Longest delay between bytes after backing off
+#define TALKIE_SPI_TUNE_TRANSFERS 64		///< Clean transfers before trying a 1us shorter delay
+#define TALKIE_SPI_PROBE_LENGTH 32			///< Chars echoed by each calibration probe
 
 
 #define TALKIE_MAX_NAMES 8
@@ -64,6 +67,18 @@ protected:
     int _ss_pin = 10;
 	// Just create a pointer to the existing SPI object
 
+	/**
+	 * @brief Per Slave timing, given that an ESP32 Slave answers much faster than an AVR one
+	 * @note The Status Bytes get 2us more than the data bytes, like the original 12us vs 10us
+	 */
+	struct Timing {
+		uint8_t byte_delay_us;		// Delay between data bytes
+		uint8_t clean_transfers;	// Transfers without errors since the last adjustment
+	};
+
+	Timing _timing = {TALKIE_SPI_DELAY_US, 0};
+	int _attention_pin = -1;	// Optional line the Slave pulls LOW when it has something to send
+
 
     // Constructor
     SPI_Arduino_Arduino_Master_Single(int ss_pin) : BroadcastSocket() {
@@ -86,8 +101,96 @@ protected:
     
     // Specific methods associated to Arduino SPI as Master
 
+    /**
+     * @brief Backs off the delay of a Slave by 1.5 times after a transfer error
+     * @param timing The timing profile of the Slave
+     */
+	void _timingError(Timing& timing) {
+		uint8_t byte_delay_us = timing.byte_delay_us + (timing.byte_delay_us >> 1) + 1;
+		timing.byte_delay_us = byte_delay_us < TALKIE_SPI_MAX_DELAY_US ? byte_delay_us : TALKIE_SPI_MAX_DELAY_US;
+		timing.clean_transfers = 0;
+	}
+
+
+    /**
+     * @brief Shortens the delay of a Slave by 1us after `TALKIE_SPI_TUNE_TRANSFERS` clean transfers
+     * @param timing The timing profile of the Slave
+     * 
+     * @note Together with `_timingError` it keeps searching for the shortest safe delay
+     */
+	void _timingClean(Timing& timing) {
+		if (++timing.clean_transfers >= TALKIE_SPI_TUNE_TRANSFERS) {
+			timing.clean_transfers = 0;
+			if (timing.byte_delay_us > TALKIE_SPI_MIN_DELAY_US) timing.byte_delay_us--;
+		}
+	}
+
+
+    /**
+     * @brief Echoes a probe to the Slave with a given delay and aborts it with an ERROR
+     * @param ss_pin The SS pin of the Slave
+     * @param byte_delay_us The delay between bytes being tried
+     * @return true if all probe chars were echoed back
+     * 
+     * @note The aborted probe is discarded by the Slave, so, nothing is delivered to its talkers
+     */
+	bool _probeSPI(int ss_pin, uint8_t byte_delay_us) {
+		bool clean = false;
+
+		digitalWrite(ss_pin, LOW);
+		delayMicroseconds(5);
+
+		uint8_t c = _spi_instance->transfer(TALKIE_SB_RECEIVE);
+		if (c != TALKIE_SB_VOID) {
+
+			delayMicroseconds(byte_delay_us + 2);
+			c = _spi_instance->transfer('0');
+			if (c == TALKIE_SB_READY) {
+				clean = true;
+				for (uint8_t i = 1; i < TALKIE_SPI_PROBE_LENGTH; i++) {
+					delayMicroseconds(byte_delay_us);
+					c = _spi_instance->transfer('0' + i);	// Receives the echoed '0' + i - 1
+					if (i > 1 && c != '0' + i - 2) {
+						clean = false;
+						break;
+					}
+				}
+			}
+			delayMicroseconds(TALKIE_SPI_DELAY_US + 2);
+			_spi_instance->transfer(TALKIE_SB_ERROR);	// Makes the Slave drop the probe
+		}
+
+		delayMicroseconds(5);
+		digitalWrite(ss_pin, HIGH);
+		return clean;
+	}
+
+
+    /**
+     * @brief Sets the shortest delay with which the Slave echoes two probes in a row, plus 1us
+     * @param ss_pin The SS pin of the Slave
+     * @param timing The timing profile of the Slave
+     * 
+     * @note If no shorter delay passes, the delay stays as `TALKIE_SPI_DELAY_US`
+     */
+	void _calibrateSPI(int ss_pin, Timing& timing) {
+		timing.clean_transfers = 0;
+		for (uint8_t byte_delay_us = TALKIE_SPI_MIN_DELAY_US; byte_delay_us < TALKIE_SPI_DELAY_US; byte_delay_us++) {
+			if (_probeSPI(ss_pin, byte_delay_us) && _probeSPI(ss_pin, byte_delay_us)) {
+				timing.byte_delay_us = byte_delay_us + 1;
+				break;
+			}
+		}
+
+		#ifdef BROADCAST_SPI_DEBUG
+		Serial.print(F("\tcalibrateSPI1: Delay between bytes (us): "));
+		Serial.println(timing.byte_delay_us);
+		#endif
+	}
+
+
 	
-    bool sendSPI(int ss_pin, const char* message_buffer, size_t length) {
+    bool sendSPI(int ss_pin, Timing& timing, const char* message_buffer, size_t length) {
         size_t size = 0;	// No interrupts, so, not volatile
 		
 		#ifdef BROADCAST_SPI_DEBUG_1
@@ -118,13 +221,13 @@ protected:
 
 				if (c != TALKIE_SB_VOID) {
 
-					delayMicroseconds(12);	// Makes sure it's processed by the slave (12us) (critical path)
+					delayMicroseconds(timing.byte_delay_us + 2);	// Makes sure it's processed by the slave (critical path)
 					c = _spi_instance->transfer(message_buffer[0]);
 
 					if (c == TALKIE_SB_READY) {	// Makes sure the Slave it's ready first
 					
 						for (uint8_t i = 1; i < length; i++) {
-							delayMicroseconds(send_delay_us);
+							delayMicroseconds(timing.byte_delay_us);
 							c = _spi_instance->transfer(message_buffer[i]);	// Receives the echoed message_buffer[i - 1]
 							if (c < 128) {
 								// Offset of 2 picks all mismatches than an offset of 1
@@ -148,16 +251,16 @@ protected:
 							}
 						}
 						// Checks the last 2 chars still to be checked
-						delayMicroseconds(12);    // Makes sure the Status Byte is sent
+						delayMicroseconds(timing.byte_delay_us + 2);    // Makes sure the Status Byte is sent
 						c = _spi_instance->transfer(TALKIE_SB_LAST);
 						if (c == message_buffer[length - 2]) {
-							delayMicroseconds(12);    // Makes sure the Status Byte is sent
+							delayMicroseconds(timing.byte_delay_us + 2);    // Makes sure the Status Byte is sent
 							c = _spi_instance->transfer(TALKIE_SB_END);
 							if (c == message_buffer[length - 1]) {	// Last char
 								size = length + 1;	// Just for error catch
 								// Makes sure Slave does the respective sets
 								for (uint8_t end_r = 0; c != TALKIE_SB_DONE && end_r < 3; end_r++) {	// Makes sure the receiving buffer of the Slave is deleted, for sure!
-									delayMicroseconds(10);
+									delayMicroseconds(timing.byte_delay_us);
 									c = _spi_instance->transfer(TALKIE_SB_END);
 								}
 								#ifdef BROADCAST_SPI_DEBUG_1
@@ -175,6 +278,11 @@ protected:
 							Serial.println(length - 2);
 							#endif
 						}
+						if (size == 0) {
+							_timingError(timing);
+						} else {
+							_timingClean(timing);
+						}
 					} else if (c == TALKIE_SB_BUSY) {
 						#ifdef BROADCAST_SPI_DEBUG_1
 						Serial.println(F("\t\tBUSY: Slave is busy, waiting a little."));
@@ -190,8 +298,10 @@ protected:
 						#ifdef BROADCAST_SPI_DEBUG_1
 						Serial.println(F("\t\tERROR: Received RECEIVE back, need to retry"));
 						#endif
+						_timingError(timing);	// The Slave didn't process the RECEIVE in time
 					} else {
 						size = 1;	// Nothing to be sent
+						_timingError(timing);	// Most likely a stale byte from a Slave still processing
 						#ifdef BROADCAST_SPI_DEBUG_1
 						Serial.print(F("\t\tERROR: Device NOT ready wit the reply: "));
 						Serial.println(c, HEX);
@@ -206,7 +316,7 @@ protected:
 				}
 
 				if (size == 0) {
-					delayMicroseconds(12);    // Makes sure the Status Byte is sent
+					delayMicroseconds(timing.byte_delay_us + 2);    // Makes sure the Status Byte is sent
 					_spi_instance->transfer(TALKIE_SB_ERROR);
 					#ifdef BROADCAST_SPI_DEBUG_1
 					Serial.println(F("\t\t\tSent ERROR back to the Slave"));
@@ -246,7 +356,7 @@ protected:
     }
 
 
-    size_t receiveSPI(int ss_pin, char* message_buffer, size_t buffer_size = TALKIE_BUFFER_SIZE) {
+    size_t receiveSPI(int ss_pin, Timing& timing, char* message_buffer, size_t buffer_size = TALKIE_BUFFER_SIZE) {
         size_t size = 0;	// No interrupts, so, not volatile
         uint8_t c;			// Avoid using 'char' while using values above 127
 
@@ -265,33 +375,33 @@ protected:
 			
 			if (c != TALKIE_SB_VOID) {
 
-				delayMicroseconds(12);	// Makes sure it's processed by the slave (12us) (critical path)
+				delayMicroseconds(timing.byte_delay_us + 2);	// Makes sure it's processed by the slave (critical path)
 				c = _spi_instance->transfer('\0');   // Dummy char to get the ACK
 
 				if (c == TALKIE_SB_READY) {	// Makes sure the Slave it's ready first
 					
-					delayMicroseconds(receive_delay_us);
+					delayMicroseconds(timing.byte_delay_us);
 					c = _spi_instance->transfer('\0');   // Dummy char to get the ACK
 					message_buffer[0] = c;
 
 					// Starts to receive all chars here
 					for (uint8_t i = 1; c < 128 && i < buffer_size; i++) { // First i isn't a char byte
-						delayMicroseconds(receive_delay_us);
+						delayMicroseconds(timing.byte_delay_us);
 						c = _spi_instance->transfer(message_buffer[i - 1]);
 						message_buffer[i] = c;
 						size = i;
 					}
 					if (c == TALKIE_SB_LAST) {
-						delayMicroseconds(receive_delay_us);    // Makes sure the Status Byte is sent
+						delayMicroseconds(timing.byte_delay_us);    // Makes sure the Status Byte is sent
 						c = _spi_instance->transfer(message_buffer[size]);  // Replies the last char to trigger END in return
 						#ifdef BROADCAST_SPI_DEBUG_1
 						Serial.println(F("\t\tReceived LAST"));
 						#endif
 						if (c == TALKIE_SB_END) {
-							delayMicroseconds(10);	// Makes sure the Status Byte is sent
+							delayMicroseconds(timing.byte_delay_us);	// Makes sure the Status Byte is sent
 							c = _spi_instance->transfer(TALKIE_SB_END);	// Replies the END to confirm reception and thus Slave buffer deletion
 							for (uint8_t end_s = 0; c != TALKIE_SB_DONE && end_s < 3; end_s++) {	// Makes sure the sending buffer of the Slave is deleted, for sure!
-								delayMicroseconds(10);
+								delayMicroseconds(timing.byte_delay_us);
 								c = _spi_instance->transfer(TALKIE_SB_END);
 							}
 							#ifdef BROADCAST_SPI_DEBUG_1
@@ -305,7 +415,7 @@ protected:
 							#endif
 						}
 					} else if (size == buffer_size) {
-						delayMicroseconds(12);    // Makes sure the Status Byte is sent
+						delayMicroseconds(timing.byte_delay_us + 2);    // Makes sure the Status Byte is sent
 						_spi_instance->transfer(TALKIE_SB_FULL);
 						size = 1;	// Try no more
 						#ifdef BROADCAST_SPI_DEBUG_1
@@ -317,6 +427,11 @@ protected:
 						Serial.println(F("\t\tERROR: Receiving sequence wasn't followed"));
 						#endif
 					}
+					if (size == 0) {
+						_timingError(timing);
+					} else {
+						_timingClean(timing);
+					}
 				} else if (c == TALKIE_SB_NONE) {
 					size = 1; // Nothing received
 					#ifdef BROADCAST_SPI_DEBUG_2
@@ -330,6 +445,7 @@ protected:
 					#ifdef BROADCAST_SPI_DEBUG_1
 					Serial.println(F("\t\tERROR: Received SEND back, need to retry"));
 					#endif
+					_timingError(timing);	// The Slave didn't process the SEND in time
 				} else if (c == TALKIE_SB_FULL) {
 					#ifdef BROADCAST_SPI_DEBUG_1
 					Serial.println(F("\t\tERROR: Slave buffer overflow"));
@@ -340,10 +456,11 @@ protected:
 					Serial.println(c, HEX);
 					#endif
 					size = 1; // Nothing received
+					_timingError(timing);	// Most likely a stale byte from a Slave still processing
 				}
 
 				if (size == 0) {
-					delayMicroseconds(12);    // Makes sure the Status Byte is sent
+					delayMicroseconds(timing.byte_delay_us + 2);    // Makes sure the Status Byte is sent
 					_spi_instance->transfer(TALKIE_SB_ERROR);    // Results from ERROR or NACK send by the Slave and makes Slave reset to NONE
 					#ifdef BROADCAST_SPI_DEBUG_1
 					Serial.println(F("\t\t\tSent ERROR back to the Slave"));
@@ -385,7 +502,7 @@ protected:
     }
 
 
-    bool acknowledgeSPI(int ss_pin) {
+    bool acknowledgeSPI(int ss_pin, Timing& timing) {
         uint8_t c; // Avoid using 'char' while using values above 127
         bool acknowledge = false;
 
@@ -404,7 +521,7 @@ protected:
 
 			if (c != TALKIE_SB_VOID) {
 
-				delayMicroseconds(12);
+				delayMicroseconds(timing.byte_delay_us + 2);
 				c = _spi_instance->transfer(TALKIE_SB_ACK);  // When the response is collected
 				
 				if (c == TALKIE_SB_ACK) {
@@ -429,6 +546,10 @@ protected:
             digitalWrite(ss_pin, HIGH);
         }
 
+        if (acknowledge) {
+			_calibrateSPI(ss_pin, timing);
+		}
+
         #ifdef BROADCAST_SPI_DEBUG_1
         if (acknowledge) {
             Serial.println(F("Slave is ready!"));
@@ -444,7 +565,8 @@ protected:
     // Socket processing is always Half-Duplex because there is just one buffer to receive and other to send
     void _receive() override {
 
-		if (_spi_instance) {
+		// Without an asserted attention line there is nothing to be polled
+		if (_spi_instance && (_attention_pin < 0 || digitalRead(_attention_pin) == LOW)) {
 
 			#ifdef BROADCAST_SPI_DEBUG_TIMING
 			_reference_time = millis();
@@ -452,7 +574,7 @@ protected:
 
 			JsonMessage new_message;
 			char* message_buffer = new_message._write_buffer();
-			size_t length = receiveSPI(_ss_pin, message_buffer);
+			size_t length = receiveSPI(_ss_pin, _timing, message_buffer);
 
 			if (length > 0) {
 				
@@ -509,7 +631,7 @@ protected:
 			
 			const char* message_buffer = json_message._read_buffer();
 			size_t message_length = json_message._get_length();
-			sendSPI(_ss_pin, message_buffer, message_length);
+			sendSPI(_ss_pin, _timing, message_buffer, message_length);
 
 			#ifdef BROADCAST_SPI_DEBUG_TIMING
 			Serial.print(" | ");
@@ -533,6 +655,20 @@ public:
 
     const char* class_name() const override { return "SPI_Arduino_Arduino_Master_Single"; }
 
+
+    /**
+     * @brief Sets the open-drain attention line the Slave pulls LOW while it has something to send
+     * @param attention_pin The attention pin, or -1 to go back to blind polling
+     * 
+     * @note Only the Slave asserting the line is polled
+     */
+	void set_attention_pin(int attention_pin) {
+		_attention_pin = attention_pin;
+		if (_attention_pin >= 0) {
+			pinMode(_attention_pin, INPUT_PULLUP);
+		}
+	}
+
 };
 
 
@@ -0,0 +1,139 @@
+// Host stand-in of the Arduino core, just what the Talkie SPI and Serial sockets and their core need
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string>
+#include <type_traits>
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+typedef uint8_t byte;
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#ifndef LED_BUILTIN
+#define LED_BUILTIN 13
+#endif
+#ifndef MISO
+#define MISO 12
+#endif
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define pgm_read_ptr(p) (*(void* const*)(p))
+#define strcmp_P strcmp
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define memcpy_P memcpy
+typedef const char* PGM_P;
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+
+
+// The simulated time only moves with the bus, the delays and the modelled ISRs
+extern uint32_t sim_micros;
+inline unsigned long micros() { return sim_micros; }
+inline unsigned long millis() { return sim_micros / 1000; }
+inline void delayMicroseconds(unsigned int us) { sim_micros += us; }
+inline void delay(unsigned long ms) { sim_micros += ms * 1000; }
+
+// Pin writes are routed to the simulator, given that the SS pins drive the Slave
+extern void sim_digital_write(int pin, int value);
+inline void pinMode(int, int) {}
+inline void digitalWrite(int pin, int value) { sim_digital_write(pin, value); }
+inline int digitalRead(int) { return HIGH; }
+inline int analogRead(int) { return 0; }
+inline long random(long a, long b) { return a + rand() % (b - a); }
+inline long random(long b) { return rand() % b; }
+inline void randomSeed(unsigned long seed) { srand(seed); }
+inline void tone(int, unsigned int, unsigned long = 0) {}
+inline void noInterrupts() {}
+inline void interrupts() {}
+inline void noTone(int) {}
+
+
+class String : public std::string {
+public:
+	String() {}
+	String(const char* s) : std::string(s ? s : "") {}
+	String(const std::string& s) : std::string(s) {}
+	String(int v) : std::string(std::to_string(v)) {}
+	String(unsigned int v) : std::string(std::to_string(v)) {}
+	String(long v) : std::string(std::to_string(v)) {}
+	String(unsigned long v) : std::string(std::to_string(v)) {}
+	operator const char*() const { return c_str(); }
+};
+
+
+// Debug prints of the sockets go to stdout
+class Print {
+public:
+	virtual size_t write(uint8_t c) { return fwrite(&c, 1, 1, stdout); }
+	virtual size_t write(const uint8_t* b, size_t n) { return fwrite(b, 1, n, stdout); }
+	size_t write(const char* b, size_t n) { return write((const uint8_t*)b, n); }
+	size_t write(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+	template<typename T> size_t print(const T& v) { std::string s = _s(v); return write((const uint8_t*)s.data(), s.size()); }
+	template<typename T> size_t print(const T& v, int) { return print(v); }
+	template<typename T> size_t println(const T& v) { size_t n = print(v); return n + print("\n"); }
+	template<typename T> size_t println(const T& v, int) { return println(v); }
+	size_t println() { return print("\n"); }
+	virtual ~Print() {}
+protected:
+	static std::string _s(const char* v) { return v ? v : "(null)"; }
+	static std::string _s(char* v) { return v ? v : "(null)"; }
+	static std::string _s(const __FlashStringHelper* v) { return (const char*)v; }
+	static std::string _s(char v) { return std::string(1, v); }
+	template<typename T> static typename std::enable_if<std::is_convertible<T, std::string>::value, std::string>::type _s(const T& v) { return (std::string)v; }
+	template<typename T> static typename std::enable_if<!std::is_convertible<T, std::string>::value, std::string>::type _s(const T& v) { return std::to_string(v); }
+};
+
+class Stream : public Print {
+public:
+	virtual int available() { return 0; }
+	virtual int read() { return -1; }
+	virtual int peek() { return -1; }
+	size_t readBytes(char* b, size_t n) { size_t i = 0; int c; while (i < n && (c = read()) >= 0) b[i++] = (char)c; return i; }
+	size_t readBytes(uint8_t* b, size_t n) { return readBytes((char*)b, n); }
+	void setTimeout(unsigned long) {}
+};
+
+// Writes to stdout and reads nothing, unless given a host file descriptor to use, like a pty
+class HardwareSerial : public Stream {
+public:
+	int fd = -1;
+	void begin(unsigned long) {}
+	void flush() {}
+	int availableForWrite() { return 64; }
+	operator bool() const { return true; }
+	int available() override { int n = 0; return fd >= 0 && ioctl(fd, FIONREAD, &n) == 0 ? n : 0; }
+	int read() override { uint8_t c; return fd >= 0 && ::read(fd, &c, 1) == 1 ? c : -1; }
+	size_t readBytes(char* b, size_t n) { ssize_t r = fd >= 0 ? ::read(fd, b, n) : 0; return r > 0 ? (size_t)r : 0; }
+	size_t readBytes(uint8_t* b, size_t n) { return readBytes((char*)b, n); }
+	size_t write(uint8_t c) override { return write(&c, 1); }
+	size_t write(const uint8_t* b, size_t n) override {
+		if (fd < 0) return Print::write(b, n);
+		size_t written = 0;
+		while (written < n) {
+			ssize_t w = ::write(fd, b + written, n - written);
+			if (w <= 0) break;
+			written += (size_t)w;
+		}
+		return written;
+	}
+	using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+
+#endif // SIM_ARDUINO_H
@@ -0,0 +1,36 @@
+// Host stand-in of the Arduino SPI library, every Master byte goes through the modelled bus
+#ifndef SIM_SPI_H
+#define SIM_SPI_H
+
+#include <Arduino.h>
+
+#define SPI_MODE0 0
+#define MSBFIRST 1
+#define SPI_CLOCK_DIV2 2
+#define SPI_CLOCK_DIV4 4
+#define SPI_CLOCK_DIV8 8
+#define SPI_CLOCK_DIV16 16
+
+extern uint8_t sim_spi_transfer(uint8_t c);
+
+struct SPISettings { SPISettings(uint32_t = 0, int = 0, int = 0) {} };
+
+class SPIClass {
+public:
+	SPIClass(int = 0) {}
+	void begin() {}
+	void begin(int, int, int, int) {}
+	void end() {}
+	void setClockDivider(int) {}
+	void setDataMode(int) {}
+	void setBitOrder(int) {}
+	void setFrequency(uint32_t) {}
+	void beginTransaction(SPISettings) {}
+	void endTransaction() {}
+	uint8_t transfer(uint8_t c) { return sim_spi_transfer(c); }
+};
+
+extern SPIClass SPI;
+
+
+#endif // SIM_SPI_H
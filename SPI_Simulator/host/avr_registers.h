@@ -0,0 +1,32 @@
+// AVR SPI Slave registers and ISR macros, force included so the real Slave socket compiles on the host
+#ifndef SIM_AVR_REGISTERS_H
+#define SIM_AVR_REGISTERS_H
+
+#include <Arduino.h>
+#include <SPI.h>
+
+extern uint8_t sim_spdr;
+#define SPDR sim_spdr
+extern uint8_t SPCR, PCICR, PCMSK0, PINB, DDRB;
+
+#define _BV(b) (1 << (b))
+#define SPE 6
+#define SPIE 7
+#define DORD 5
+#define CPOL 3
+#define CPHA 2
+#define PCIE0 0
+#define PCINT2 2
+#define PINB2 2
+#define DDB4 4
+
+// Timer1, that with TALKIE_SPI_PROFILE counts the ISR cycles, here read from the host cycle counter
+extern uint8_t TCCR1A, TCCR1B;
+extern uint16_t sim_cycles();
+#define TCNT1 sim_cycles()
+#define CS10 0
+
+#define ISR(vector) void vector()
+
+
+#endif // SIM_AVR_REGISTERS_H
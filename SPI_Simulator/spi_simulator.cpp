@@ -0,0 +1,377 @@
+/*
+JsonTalkie - Json Talkie is intended for direct IoT communication.
+Original Copyright (c) 2025 Rui Seixas Monteiro. All right reserved.
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Lesser General Public License for more details.
+https://github.com/ruiseixasm/JsonTalkie
+*/
+
+// Runs the real SPI Master socket code against the real AVR Slave ISR over a modelled bus,
+// see the README.md for how to build and use it
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <chrono>
+#include "../JsonMidiCreator/TalkieSPI_Slave_Buzzer/src/sockets/SPI_Arduino_Slave.h"
+#include "../JsonMidiCreator/TalkieSerial_SPI_Multiple/src/sockets/SPI_Arduino_Arduino_Master_Multiple.hpp"
+
+
+uint32_t sim_micros = 0;
+HardwareSerial Serial;
+SPIClass SPI;
+uint8_t sim_spdr = 0, SPCR = 0, PCICR = 0, PCMSK0 = 0, PINB = _BV(PINB2), DDRB = _BV(DDB4);
+uint8_t TCCR1A = 0, TCCR1B = 0;
+
+// Stands in for Timer1, in host cycles, good to compare ISR paths and versions with each other,
+// the AVR cycles themselves come from the board with TALKIE_SPI_PROFILE
+uint16_t sim_cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+	return (uint16_t)__builtin_ia32_rdtsc();
+#else
+	return (uint16_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void SPI_STC_vect();
+#ifdef TALKIE_SPI_SS_PCINT
+void PCINT0_vect();
+#endif
+
+
+#define SIM_SS_PIN 10		// PB2, the Slave SS
+#define SIM_MAX_SWEEP 16
+
+
+/**
+ * @brief The modelled bus, a byte takes `byte_us` and each Slave ISR `isr_us` plus up to `jitter_us`
+ *
+ * @note Like on the AVR, the Slave reads the byte when its ISR starts and loads the reply when it ends,
+ *       a reply loaded after the Master started the next byte is lost (the Master gets its own previous
+ *       byte echoed by the shift register) and a byte still not read when the next one completes is
+ *       overwritten
+ */
+struct Bus {
+	unsigned byte_us = 2;		// 4MHz
+	unsigned isr_us = 8;
+	unsigned jitter_us = 0;
+	bool trace = false;
+
+	bool selected = false;
+	bool pending = false;		// A received byte waiting for its ISR
+	uint8_t pending_byte = 0;
+	uint32_t isr_start = 0;
+	uint32_t isr_end = 0;
+	bool loaded = false;		// The ISR loaded SPDR in time for the next byte
+	uint8_t loaded_byte = 0;
+	uint8_t shift_byte = 0xFF;	// What MISO shifts out when nothing was loaded
+
+	// Error modes
+	unsigned transactions = 0;
+	unsigned lost_bytes = 0;
+	unsigned late_replies = 0;
+};
+
+Bus bus;
+
+
+// Runs the ISR of the pending byte, keeping its reply only if loaded before `now`
+void run_pending_isr(uint32_t now) {
+	if (!bus.pending) return;
+	bus.pending = false;
+	sim_spdr = bus.pending_byte;
+	SPI_STC_vect();
+	if (bus.isr_end <= now) {
+		bus.loaded = true;
+		bus.loaded_byte = sim_spdr;
+	} else {
+		bus.late_replies++;
+	}
+}
+
+
+uint8_t sim_spi_transfer(uint8_t c) {
+	uint32_t now = sim_micros;
+	if (!bus.selected) {
+		sim_micros += bus.byte_us;
+		return 0xFF;	// Floating MISO
+	}
+	if (bus.pending && bus.isr_start >= now + bus.byte_us) {
+		bus.pending = false;	// Overwritten by this byte before being read
+		bus.lost_bytes++;
+	}
+	run_pending_isr(now);
+	uint8_t out = bus.loaded ? bus.loaded_byte : bus.shift_byte;
+	if (!(DDRB & _BV(DDB4))) out = 0xFF;	// MISO released by the Slave, read as floating
+	bus.loaded = false;
+	sim_micros = now + bus.byte_us;
+
+	bus.shift_byte = c;
+	bus.pending = true;
+	bus.pending_byte = c;
+	bus.isr_start = sim_micros > bus.isr_end ? sim_micros : bus.isr_end;
+	bus.isr_end = bus.isr_start + bus.isr_us + (bus.jitter_us ? rand() % (bus.jitter_us + 1) : 0);
+
+	if (bus.trace) printf("    [%7u] m>%02X s>%02X\n", now, c, out);
+	return out;
+}
+
+
+void sim_digital_write(int pin, int value) {
+	if (pin != SIM_SS_PIN) return;
+	if (value == LOW) {
+		if (!bus.selected) bus.transactions++;
+		bus.selected = true;
+		PINB = 0;
+	} else {
+		// The last ISR still runs after the SS rises
+		if (bus.pending && bus.isr_end > sim_micros) sim_micros = bus.isr_end;
+		run_pending_isr(sim_micros);
+		bus.selected = false;
+		PINB = _BV(PINB2);
+		#ifdef TALKIE_SPI_SS_PCINT
+		PCINT0_vect();
+		#else
+		SPI_Arduino_Slave::handleSS_Interrupt();	// The Slave loop, taken as running between transactions
+		#endif
+	}
+}
+
+
+// Exposes the protected parts of both sockets to the simulator
+struct Slave : SPI_Arduino_Slave {
+	using SPI_Arduino_Slave::_send;
+	using SPI_Arduino_Slave::_sending_length;
+	using SPI_Arduino_Slave::_received_length;
+	using SPI_Arduino_Slave::_received_buffer;
+	using SPI_Arduino_Slave::_isr_state;
+};
+
+struct Master : SPI_Arduino_Arduino_Master_Multiple {
+	Master(int* ss_pins, uint8_t ss_pins_count) : SPI_Arduino_Arduino_Master_Multiple(ss_pins, ss_pins_count) {}
+	using SPI_Arduino_Arduino_Master_Multiple::Timing;
+	using SPI_Arduino_Arduino_Master_Multiple::_timingOf;
+	using SPI_Arduino_Arduino_Master_Multiple::_calibrateSPI;
+	using SPI_Arduino_Arduino_Master_Multiple::sendSPI;
+	using SPI_Arduino_Arduino_Master_Multiple::receiveSPI;
+	using SPI_Arduino_Arduino_Master_Multiple::_exchanged_length;
+	using SPI_Arduino_Arduino_Master_Multiple::_exchanged_buffer;
+};
+
+
+struct Result {
+	unsigned ok = 0;
+	uint32_t bus_us = 0;
+	unsigned transactions = 0;
+};
+
+
+void print_result(const char* name, const Result& result, unsigned count, size_t length) {
+	double per_message = result.ok ? (double)result.bus_us / result.ok : 0;
+	double kbytes_s = result.bus_us ? (double)result.ok * length * 1000.0 / result.bus_us : 0;
+	printf(" | %3u/%-3u %7.1f %6.1f %4u", result.ok, count, per_message, kbytes_s, result.transactions - result.ok);
+	(void)name;
+}
+
+
+#ifdef TALKIE_SPI_PROFILE
+// In the order of `SPI_Arduino_Slave::IsrState`
+const char* isr_state_names[SPI_Arduino_Slave::TALKIE_ISR_STATES] = {
+	"IDLE", "RECEIVE", "SEND", "VERSION", "RECEIVE_LENGTH", "RECEIVE_FRAME", "SEND_FRAME", "SEND_CRC", "SEND_END",
+	"EXCHANGE_LENGTH", "EXCHANGE_FRAME", "EXCHANGE_VERDICT", "BROADCAST_LENGTH", "BROADCAST_FRAME", "BROADCAST_IGNORE"
+};
+
+
+void print_profile(const SPI_Arduino_Slave& slave) {
+	printf("\nISR paths in host cycles, data bytes by state and Status Bytes by value\n");
+	printf("path               calls   mean  worst\n");
+	for (uint8_t path_i = 0; path_i < SPI_Arduino_Slave::TALKIE_ISR_PATHS; path_i++) {
+		uint16_t worst_cycles, calls;
+		uint32_t total_cycles;
+		if (!slave.get_isr_profile(path_i, worst_cycles, calls, total_cycles) || !calls) continue;
+		if (path_i < SPI_Arduino_Slave::TALKIE_ISR_STATES) {
+			printf("%-16s", isr_state_names[path_i]);
+		} else {
+			printf("status 0x%02X     ", SPI_Arduino_Slave::TALKIE_SB_BROADCAST_STATUS + path_i - SPI_Arduino_Slave::TALKIE_ISR_STATES);
+		}
+		printf(" %7u %6.1f %6u\n", calls, (double)total_cycles / calls, worst_cycles);
+	}
+}
+#endif
+
+
+int main(int argc, char** argv) {
+
+	unsigned isr_list[SIM_MAX_SWEEP] = {2, 4, 6, 8, 10, 12, 14, 16};
+	unsigned isr_count = 8;
+	unsigned clock_khz = 4000;
+	unsigned jitter_us = 0;
+	unsigned version = TALKIE_SPI_VERSION;
+	unsigned count = 200;
+	bool trace = false;
+	bool broadcast = false;
+	unsigned seed = 1;
+
+	for (int arg_i = 1; arg_i < argc; arg_i++) {
+		const char* arg = argv[arg_i];
+		const char* value = arg_i + 1 < argc ? argv[arg_i + 1] : "0";
+		if (!strcmp(arg, "--isr-us")) {
+			isr_count = 0;
+			for (const char* p = value; *p && isr_count < SIM_MAX_SWEEP; ) {
+				isr_list[isr_count++] = (unsigned)strtoul(p, (char**)&p, 10);
+				if (*p == ',') p++;
+			}
+			arg_i++;
+		} else if (!strcmp(arg, "--clock-khz")) { clock_khz = atoi(value); arg_i++; }
+		else if (!strcmp(arg, "--jitter-us")) { jitter_us = atoi(value); arg_i++; }
+		else if (!strcmp(arg, "--version")) { version = atoi(value); arg_i++; }
+		else if (!strcmp(arg, "--count")) { count = atoi(value); arg_i++; }
+		else if (!strcmp(arg, "--seed")) { seed = atoi(value); arg_i++; }
+		else if (!strcmp(arg, "--trace")) { trace = true; }
+		#ifdef TALKIE_SPI_SS_PCINT
+		else if (!strcmp(arg, "--broadcast")) { broadcast = true; }
+		#endif
+		else {
+			printf("Usage: %s [--isr-us 2,4,8] [--jitter-us 0] [--clock-khz 4000] [--version 1..%u] [--count 200] [--seed 1] [--trace]"
+				#ifdef TALKIE_SPI_SS_PCINT
+				" [--broadcast]"
+				#endif
+				"\n", argv[0], TALKIE_SPI_VERSION);
+			return 1;
+		}
+	}
+	if (broadcast && version < 4) {
+		printf("The broadcast is version 4\n");
+		return 1;
+	}
+	bus.byte_us = clock_khz ? (8000 + clock_khz - 1) / clock_khz : 2;
+	bus.jitter_us = jitter_us;
+	bus.trace = trace;
+	srand(seed);
+
+	const char* message = "{\"m\":2,\"b\":0,\"i\":13,\"f\":\"master\",\"t\":\"slave\",\"a\":\"buzz\",\"0\":\"abcdefghijklmnopqrstuvwxyz\"}";
+	size_t message_length = strlen(message);
+	JsonMessage reply;
+	memcpy(reply._write_buffer(message_length), message, message_length);
+	reply._set_length(message_length);
+
+	printf("Bus %u us per byte, ISR jitter up to %u us, %u messages of %u bytes per mode\n",
+		bus.byte_us, jitter_us, count, (unsigned)message_length);
+	printf("  us per message, KB/s of payload and extra transactions (retries) for each mode\n");
+	printf("isr ver dly |  send ok   us/msg   KB/s rtry |  recv ok   us/msg   KB/s rtry |  exch ok  us/pair   KB/s rtry | lost late errs dly blk\n");
+
+	Slave& slave = (Slave&)SPI_Arduino_Slave::instance();
+	#ifdef TALKIE_SPI_SS_PCINT
+	slave.set_broadcast(broadcast);	// MISO released between transactions, answering version 4
+	#endif
+	int ss_pins[1] = {SIM_SS_PIN};
+	unsigned incomplete = 0;	// Rows with any mode delivering less than all its messages
+	unsigned first_lost = 0;	// Rows losing the first message of any mode, the one right after the calibration
+
+	for (unsigned isr_i = 0; isr_i < isr_count; isr_i++) {
+		bus.isr_us = isr_list[isr_i];
+		bus.pending = bus.loaded = false;
+		bus.isr_end = sim_micros;
+		bus.lost_bytes = bus.late_replies = 0;
+		Slave::_isr_state = SPI_Arduino_Slave::TALKIE_ISR_IDLE;
+		Slave::_sending_length = 0;
+		Slave::_received_length = 0;
+
+		Master master(ss_pins, 1);	// Acknowledges, calibrates and negotiates the version
+		Master::Timing& timing = master._timingOf(0);
+		if (timing.version > version) {
+			timing.version = version;
+			master._calibrateSPI(SIM_SS_PIN, timing);	// Like a Slave of that version, calibrated on its own path
+		}
+		printf("%3u %3u %3u", bus.isr_us, timing.version, timing.byte_delay_us);
+
+		Result sends, receives, exchanges;
+		bool first_lost_row = false;
+		unsigned errors_before = timing.errors;
+
+		for (unsigned message_i = 0; message_i < count; message_i++) {
+			sim_micros += 100;	// Master loop between messages
+			Slave::_received_length = 0;
+			uint32_t start = sim_micros;
+			unsigned transactions = bus.transactions;
+			if (master.sendSPI(SIM_SS_PIN, timing, message, message_length)
+					&& Slave::_received_length == message_length && !memcmp(Slave::_received_buffer, message, message_length)) {
+				sends.ok++;
+			} else if (!message_i) {
+				first_lost_row = true;
+			}
+			sends.bus_us += sim_micros - start;
+			sends.transactions += bus.transactions - transactions;
+		}
+
+		for (unsigned message_i = 0; message_i < count; message_i++) {
+			sim_micros += 100;
+			Slave::_sending_length = 0;
+			slave._send(reply);
+			char buffer[TALKIE_BUFFER_SIZE];
+			uint32_t start = sim_micros;
+			unsigned transactions = bus.transactions;
+			size_t length = master.receiveSPI(SIM_SS_PIN, timing, buffer);
+			if (length == message_length && !memcmp(buffer, message, length) && !Slave::_sending_length) {
+				receives.ok++;
+			} else if (!message_i) {
+				first_lost_row = true;
+			}
+			receives.bus_us += sim_micros - start;
+			receives.transactions += bus.transactions - transactions;
+		}
+
+		// A message to the Slave while it has one pending, as one exchange or as a send plus a receive
+		for (unsigned message_i = 0; message_i < count; message_i++) {
+			sim_micros += 100;
+			Slave::_sending_length = 0;
+			Slave::_received_length = 0;
+			master._exchanged_length = 0;
+			slave._send(reply);
+			uint32_t start = sim_micros;
+			unsigned transactions = bus.transactions;
+			bool sent = master.sendSPI(SIM_SS_PIN, timing, message, message_length);
+			size_t length = master._exchanged_length;
+			const char* received = master._exchanged_buffer;
+			char buffer[TALKIE_BUFFER_SIZE];
+			if (!length) {
+				length = master.receiveSPI(SIM_SS_PIN, timing, buffer);
+				received = buffer;
+			}
+			if (sent && Slave::_received_length == message_length && length == message_length && !memcmp(received, message, length)) {
+				exchanges.ok++;
+			} else if (!message_i) {
+				first_lost_row = true;
+			}
+			exchanges.bus_us += sim_micros - start;
+			exchanges.transactions += bus.transactions - transactions;
+		}
+		master._exchanged_length = 0;
+
+		print_result("send", sends, count, message_length);
+		print_result("receive", receives, count, message_length);
+		// Each exchange is one transaction doing the work of two
+		exchanges.transactions = exchanges.transactions > exchanges.ok ? exchanges.transactions : exchanges.ok;
+		print_result("exchange", exchanges, count, 2 * message_length);
+		printf(" | %4u %4u %4u %3u %3u\n", bus.lost_bytes, bus.late_replies, timing.errors - errors_before,
+			timing.byte_delay_us, timing.block_delay_us);
+		if (sends.ok < count || receives.ok < count || exchanges.ok < count) incomplete++;
+		if (first_lost_row) first_lost++;
+	}
+
+	#ifdef TALKIE_SPI_PROFILE
+	print_profile(slave);
+	#endif
+
+	if (incomplete) {
+		printf("FAILED: %u of %u ISR times lost messages, %u of them the first one\n", incomplete, isr_count, first_lost);
+		return 2;
+	}
+	return 0;
+}
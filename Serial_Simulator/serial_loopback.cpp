@@ -0,0 +1,229 @@
+/*
+JsonTalkie - Json Talkie is intended for direct IoT communication.
+Original Copyright (c) 2025 Rui Seixas Monteiro. All right reserved.
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Lesser General Public License for more details.
+https://github.com/ruiseixasm/JsonTalkie
+*/
+
+// Runs the real SocketSerial SLIP framing over a pty, its own frames looped back at a given baud rate,
+// see the README.md for how to build and use it
+
+#include <Arduino.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <time.h>
+#include <vector>
+#include "../JsonMidiCreator/TalkieSerial/src/sockets/SocketSerial.hpp"
+
+
+uint32_t sim_micros = 0;
+HardwareSerial Serial;
+
+#define LOOP_OVERSIZE 160		// Bytes of the oversize frames, more than TALKIE_BUFFER_SIZE
+
+
+static uint64_t host_micros() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+
+// Exposes the socket, keeping each delivered message instead of passing it to a repeater
+struct Loopback : SocketSerial {
+	using SocketSerial::_send;
+	using SocketSerial::_receive;
+	using SocketSerial::_putSlip;
+	using SocketSerial::_crc16;
+	std::vector<std::string> delivered;
+
+	void _startTransmission(JsonMessage& json_message) override {
+		delivered.push_back(std::string(json_message._read_buffer(), json_message._get_length()));
+	}
+};
+
+
+/**
+ * @brief What is put on the line, each frame marked as to be delivered or dropped
+ */
+struct Line {
+	std::vector<uint8_t> bytes;
+	std::vector<std::string> expected;	// The frames to be delivered, in order
+	unsigned corrupted = 0;
+	unsigned oversize = 0;
+};
+
+
+// Reads from the pty master whatever the socket wrote to Serial
+static void drain(int master_fd, std::vector<uint8_t>& bytes) {
+	uint8_t buffer[256];
+	ssize_t length;
+	while ((length = read(master_fd, buffer, sizeof(buffer))) > 0) {
+		bytes.insert(bytes.end(), buffer, buffer + length);
+	}
+}
+
+
+// Frames that the socket can't send itself, like the ones too long for a JsonMessage
+static void put_frame(std::vector<uint8_t>& bytes, const std::string& content) {
+	uint8_t frame[TALKIE_SERIAL_CHUNK];
+	uint8_t frame_i = 0;
+	uint16_t crc = 0xFFFF;
+	Loopback::_putSlip(frame, frame_i, SLIP_END, false);
+	for (char c : content) {
+		crc = Loopback::_crc16(crc, (uint8_t)c);
+		if (frame_i > TALKIE_SERIAL_CHUNK - 3) {
+			bytes.insert(bytes.end(), frame, frame + frame_i);
+			frame_i = 0;
+		}
+		Loopback::_putSlip(frame, frame_i, (uint8_t)c);
+	}
+	bytes.insert(bytes.end(), frame, frame + frame_i);
+	frame_i = 0;
+	Loopback::_putSlip(frame, frame_i, (uint8_t)(crc >> 8));
+	Loopback::_putSlip(frame, frame_i, (uint8_t)crc);
+	Loopback::_putSlip(frame, frame_i, SLIP_END, false);
+	bytes.insert(bytes.end(), frame, frame + frame_i);
+}
+
+
+/**
+ * @brief Builds the line with `count` frames sent back to back by the socket itself, one in ten of them
+ *        with a flipped byte and, in between, a valid SLIP frame too long for the message buffer
+ */
+static Line build_line(Loopback& socket, int master_fd, unsigned count) {
+	Line line;
+	for (unsigned message_i = 0; message_i < count; message_i++) {
+		char content[TALKIE_BUFFER_SIZE];
+		// The SLIP special bytes in the payload have to be escaped
+		snprintf(content, sizeof(content), "{\"m\":2,\"b\":0,\"i\":%u,\"f\":\"loop\",\"t\":\"serial\",\"0\":\"%c%c%s\"}",
+			message_i, (char)SLIP_END, (char)SLIP_ESC, "abcdefghijklmnopqrstuvwxyz");
+		JsonMessage message;
+		size_t length = strlen(content);
+		memcpy(message._write_buffer(length), content, length);
+		message._set_length(length);
+		message._insert_checksum();
+
+		std::vector<uint8_t> frame;
+		socket._send(message);
+		drain(master_fd, frame);
+		if (message_i % 10 == 3) {
+			frame[frame.size() / 2] ^= 0x01;	// A noise hit, the CRC drops it and the next frame still goes
+			line.corrupted++;
+		} else {
+			line.expected.push_back(content);
+		}
+		line.bytes.insert(line.bytes.end(), frame.begin(), frame.end());
+		if (message_i % 10 == 7) {
+			put_frame(line.bytes, "{\"m\":2,\"b\":0,\"i\":0,\"f\":\"loop\",\"0\":\"" + std::string(LOOP_OVERSIZE, 'x') + "\"}");
+			line.oversize++;
+		}
+	}
+	return line;
+}
+
+
+int main(int argc, char** argv) {
+
+	unsigned long baud_list[8] = {1000000, 500000};
+	unsigned baud_count = 2;
+	unsigned count = 200;
+
+	for (int arg_i = 1; arg_i < argc; arg_i++) {
+		const char* arg = argv[arg_i];
+		const char* value = arg_i + 1 < argc ? argv[arg_i + 1] : "0";
+		if (!strcmp(arg, "--baud")) {
+			baud_count = 0;
+			for (const char* p = value; *p && baud_count < 8; ) {
+				baud_list[baud_count++] = strtoul(p, (char**)&p, 10);
+				if (*p == ',') p++;
+			}
+			arg_i++;
+		} else if (!strcmp(arg, "--count")) { count = atoi(value); arg_i++; }
+		else {
+			printf("Usage: %s [--baud 1000000,500000] [--count 200]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	int master_fd = posix_openpt(O_RDWR | O_NOCTTY);
+	if (master_fd < 0 || grantpt(master_fd) || unlockpt(master_fd)) {
+		perror("posix_openpt");
+		return 1;
+	}
+	Serial.fd = open(ptsname(master_fd), O_RDWR | O_NOCTTY | O_NONBLOCK);
+	if (Serial.fd < 0) {
+		perror("open pty");
+		return 1;
+	}
+	struct termios raw;
+	tcgetattr(Serial.fd, &raw);
+	cfmakeraw(&raw);	// No echo nor any byte translation, like a UART
+	tcsetattr(Serial.fd, TCSANOW, &raw);
+	fcntl(master_fd, F_SETFL, O_NONBLOCK);
+
+	static Loopback socket;
+	socket.set_framing(SocketSerial::FRAMING_SLIP);
+	Line line = build_line(socket, master_fd, count);
+
+	printf("%u SLIP frames over a pty, %u with a flipped byte and %u oversize in between, %u bytes on the line\n",
+		count, line.corrupted, line.oversize, (unsigned)line.bytes.size());
+	printf("    baud |  delivered  wrong |  sustained baud\n");
+
+	unsigned failed = 0;
+	for (unsigned baud_i = 0; baud_i < baud_count; baud_i++) {
+		unsigned long baud = baud_list[baud_i];
+		socket.delivered.clear();
+		socket.set_framing(SocketSerial::FRAMING_SLIP);
+
+		// Paces the line at 10 bits per byte, the 8N1 of a UART, while the socket reads it like the sketch loop
+		size_t written = 0;
+		uint64_t start = host_micros();
+		uint64_t last_delivered = start;
+		uint64_t idle_since = 0;
+		while (true) {
+			uint64_t now = host_micros();
+			sim_micros = (uint32_t)now;
+			if (written < line.bytes.size()) {
+				size_t due = baud ? (size_t)((now - start) * baud / 10000000) : line.bytes.size();
+				if (due > line.bytes.size()) due = line.bytes.size();
+				if (due > written) {
+					ssize_t length = write(master_fd, &line.bytes[written], due - written);
+					if (length > 0) written += (size_t)length;
+				}
+			}
+			size_t delivered = socket.delivered.size();
+			socket._receive();
+			if (socket.delivered.size() != delivered) {
+				last_delivered = host_micros();
+				idle_since = 0;
+			} else if (written == line.bytes.size() && !Serial.available()) {
+				if (!idle_since) idle_since = now;
+				if (now - idle_since > 100000) break;	// All read and nothing new for 100ms
+			}
+		}
+
+		unsigned wrong = 0;
+		for (size_t message_i = 0; message_i < socket.delivered.size(); message_i++) {
+			if (message_i >= line.expected.size() || socket.delivered[message_i] != line.expected[message_i]) wrong++;
+		}
+		double elapsed = (double)(last_delivered - start) / 1000000;
+		double sustained = elapsed > 0 ? line.bytes.size() * 10 / elapsed : 0;
+		printf("%8lu | %4u/%-4u %6u | %15.0f\n",
+			baud, (unsigned)socket.delivered.size(), (unsigned)line.expected.size(), wrong, sustained);
+		if (wrong || socket.delivered.size() != line.expected.size()) failed++;
+	}
+
+	if (failed) {
+		printf("FAILED: %u of %u baud rates didn't deliver exactly the intact frames\n", failed, baud_count);
+		return 2;
+	}
+	return 0;
+}